@@ -34,6 +34,9 @@
 
 #include "BiSection.h"
 
+#include <bitset>
+#include <vector>
+
 DSS_NAMESPASE_BEGIN
 
 CMcKee :: CMcKee()
@@ -198,5 +201,318 @@ void CBiSection :: BiSect(long *nodes, long size, long &domA, long &domB)
 }
 
 
+CNestedDissection :: CNestedDissection(SparseConectivityMtxII *mtx)
+{
+    this->mtx = mtx;
+    n = mtx->N();
+
+    p_set = new long [ n ];
+    p_visit = new long [ n ];
+    p_level = new long [ n ];
+    p_part = new long [ n ];
+    p_queue = new long [ n ];
+    p_tmp = new long [ n ];
+    memset( p_set, 0, n * sizeof( long ) );
+    memset( p_visit, 0, n * sizeof( long ) );
+    set_stamp = visit_stamp = 0;
+}
+
+CNestedDissection :: ~CNestedDissection()
+{
+    delete [] p_set;
+    delete [] p_visit;
+    delete [] p_level;
+    delete [] p_part;
+    delete [] p_queue;
+    delete [] p_tmp;
+}
+
+void CNestedDissection :: NestedDissectionOrder(IntArrayList *order)
+{
+    // pending subgraphs as (start, size) pairs of the order array, the parts of
+    // a dissected subgraph occupy disjoint ranges and are processed independently
+    std :: vector< long >stack;
+    stack.push_back(0);
+    stack.push_back(order->Count);
+
+    while ( !stack.empty() ) {
+        long size = stack.back();
+        stack.pop_back();
+        long start = stack.back();
+        stack.pop_back();
+
+        long *nodes = order->Items + start;
+        long domA, domB;
+        if ( size <= leaf_size || !Separate(nodes, size, domA, domB) ) {
+            OrderLeaf(nodes, size);
+            continue;
+        }
+
+        stack.push_back(start);
+        stack.push_back(domA);
+        stack.push_back(start + domA);
+        stack.push_back(domB);
+    }
+}
+
+// Breadth first search restricted to the current set, the visited nodes are stored
+// in p_queue in the level order. Returns the number of visited nodes.
+long CNestedDissection :: LevelStructure(long root, long &n_levels, bool new_search)
+{
+    if ( new_search ) {
+        visit_stamp++;
+    }
+
+    long head = 0, tail = 0;
+    p_queue [ tail++ ] = root;
+    p_visit [ root ] = visit_stamp;
+    p_level [ root ] = 0;
+
+    while ( head < tail ) {
+        long v = p_queue [ head++ ];
+        IntArrayList &al = * mtx->ColumnsIndexes [ v ];
+        for ( long idx = 0; idx < al.Count; idx++ ) {
+            long w = al.Items [ idx ];
+            if ( p_set [ w ] != set_stamp || p_visit [ w ] == visit_stamp ) {
+                continue;
+            }
+
+            p_visit [ w ] = visit_stamp;
+            p_level [ w ] = p_level [ v ] + 1;
+            p_queue [ tail++ ] = w;
+        }
+    }
+
+    n_levels = p_level [ p_queue [ tail - 1 ] ] + 1;
+    return tail;
+}
+
+// Leaves the level structure of the returned root in p_level and p_queue,
+// count is the number of reached nodes (less than size for a disconnected set).
+long CNestedDissection :: FindPseudoPeripheralNode(long *nodes, long size, long &n_levels, long &count)
+{
+    long root = nodes [ 0 ], min_deg = n + 1, cl;
+    for ( long i = 0; i < size; i++ ) {
+        if ( ( cl = mtx->ColumnLength(nodes [ i ]) ) < min_deg ) {
+            min_deg = cl;
+            root = nodes [ i ];
+        }
+    }
+
+    count = LevelStructure(root, n_levels);
+    if ( count < size ) {
+        return root;
+    }
+
+    // restart from the node of the last level with the lowest degree while the depth grows
+    for ( int it = 0; it < 5; it++ ) {
+        long cand = -1;
+        min_deg = n + 1;
+        for ( long k = count - 1; k >= 0 && p_level [ p_queue [ k ] ] == n_levels - 1; k-- ) {
+            if ( ( cl = mtx->ColumnLength(p_queue [ k ]) ) < min_deg ) {
+                min_deg = cl;
+                cand = p_queue [ k ];
+            }
+        }
+
+        long cand_levels;
+        LevelStructure(cand, cand_levels);
+        if ( cand_levels <= n_levels ) {
+            LevelStructure(root, n_levels);
+            break;
+        }
+
+        root = cand;
+        n_levels = cand_levels;
+    }
+
+    return root;
+}
+
+bool CNestedDissection :: Separate(long *nodes, long size, long &domA, long &domB)
+{
+    set_stamp++;
+    for ( long i = 0; i < size; i++ ) {
+        p_set [ nodes [ i ] ] = set_stamp;
+        p_part [ nodes [ i ] ] = 1;
+    }
+
+    long n_levels, count;
+    FindPseudoPeripheralNode(nodes, size, n_levels, count);
+
+    if ( count < size ) {
+        // disconnected graph, whole components go to domain A until it holds a half of the nodes
+        long nA = 0, i = 0;
+        for ( ;; ) {
+            for ( long k = 0; k < count; k++ ) {
+                p_part [ p_queue [ k ] ] = 0;
+            }
+
+            nA += count;
+            if ( 2 * nA >= size ) {
+                break;
+            }
+
+            while ( p_visit [ nodes [ i ] ] == visit_stamp ) {
+                i++;
+            }
+
+            count = LevelStructure(nodes [ i ], n_levels, false);
+            if ( nA + count == size ) {
+                break;
+            }
+        }
+
+        Arrange(nodes, size, domA, domB);
+        return true;
+    }
+
+    if ( n_levels < 3 ) {
+        return false;
+    }
+
+    // the narrowest level leaving at least a fifth of the nodes on both sides becomes the separator
+    long *width = p_tmp;
+    memset( width, 0, n_levels * sizeof( long ) );
+    for ( long k = 0; k < size; k++ ) {
+        width [ p_level [ p_queue [ k ] ] ]++;
+    }
+
+    long sep = -1, mid = -1, sep_imbalance = 0;
+    long below = width [ 0 ];
+    for ( long l = 1; l < n_levels - 1; l++ ) {
+        long above = size - below - width [ l ];
+        long imbalance = labs(above - below);
+        if ( 5 * below >= size && 5 * above >= size &&
+             ( sep < 0 || width [ l ] < width [ sep ] || ( width [ l ] == width [ sep ] && imbalance < sep_imbalance ) ) ) {
+            sep = l;
+            sep_imbalance = imbalance;
+        }
+
+        if ( mid < 0 && 2 * ( below + width [ l ] ) >= size ) {
+            mid = l;
+        }
+
+        below += width [ l ];
+    }
+
+    if ( sep < 0 ) {
+        sep = mid;
+    }
+
+    if ( sep < 0 ) {
+        return false;
+    }
+
+    for ( long k = 0; k < size; k++ ) {
+        long v = p_queue [ k ];
+        p_part [ v ] = p_level [ v ] < sep ? 0 : ( p_level [ v ] > sep ? 1 : 2 );
+    }
+
+    // thin the separator, nodes without a neighbour in B join A
+    // and then nodes without a neighbour in A join B
+    for ( int pass = 0; pass < 2; pass++ ) {
+        long other = pass == 0 ? 1 : 0;
+        for ( long k = 0; k < size; k++ ) {
+            long v = p_queue [ k ];
+            if ( p_part [ v ] != 2 ) {
+                continue;
+            }
+
+            bool adjacent = false;
+            IntArrayList &al = * mtx->ColumnsIndexes [ v ];
+            for ( long idx = 0; idx < al.Count && !adjacent; idx++ ) {
+                long w = al.Items [ idx ];
+                adjacent = p_set [ w ] == set_stamp && p_part [ w ] == other;
+            }
+
+            if ( !adjacent ) {
+                p_part [ v ] = 1 - other;
+            }
+        }
+    }
+
+    Arrange(nodes, size, domA, domB);
+    return domA > 0 && domB > 0;
+}
+
+// Reorders the nodes as domain A, domain B and the separator
+void CNestedDissection :: Arrange(long *nodes, long size, long &domA, long &domB)
+{
+    long pos [ 3 ] = {
+        0, 0, 0
+    };
+    for ( long i = 0; i < size; i++ ) {
+        pos [ p_part [ nodes [ i ] ] ]++;
+    }
+
+    domA = pos [ 0 ];
+    domB = pos [ 1 ];
+    pos [ 2 ] = domA + domB;
+    pos [ 1 ] = domA;
+    pos [ 0 ] = 0;
+    for ( long i = 0; i < size; i++ ) {
+        p_tmp [ pos [ p_part [ nodes [ i ] ] ]++ ] = nodes [ i ];
+    }
+
+    Array :: Copy(p_tmp, nodes, size);
+}
+
+// Exact minimum degree on the elimination graph of a small subgraph
+void CNestedDissection :: OrderLeaf(long *nodes, long size)
+{
+    if ( size <= 2 || size > leaf_size ) {
+        return;
+    }
+
+    set_stamp++;
+    for ( long i = 0; i < size; i++ ) {
+        p_set [ nodes [ i ] ] = set_stamp;
+        p_level [ nodes [ i ] ] = i;
+    }
+
+    std :: bitset< leaf_size >adj [ leaf_size ], remaining;
+    for ( long i = 0; i < size; i++ ) {
+        IntArrayList &al = * mtx->ColumnsIndexes [ nodes [ i ] ];
+        for ( long idx = 0; idx < al.Count; idx++ ) {
+            long w = al.Items [ idx ];
+            if ( p_set [ w ] == set_stamp ) {
+                adj [ i ].set(p_level [ w ]);
+            }
+        }
+
+        remaining.set(i);
+    }
+
+    for ( long k = 0; k < size; k++ ) {
+        long best = -1;
+        size_t best_deg = 0;
+        for ( long i = 0; i < size; i++ ) {
+            if ( !remaining.test(i) ) {
+                continue;
+            }
+
+            size_t deg = ( adj [ i ] & remaining ).count();
+            if ( best < 0 || deg < best_deg ) {
+                best = i;
+                best_deg = deg;
+            }
+        }
+
+        p_tmp [ k ] = nodes [ best ];
+        remaining.reset(best);
+
+        // the neighbours of the eliminated node become a clique
+        std :: bitset< leaf_size >clique = adj [ best ] & remaining;
+        for ( long j = 0; j < size; j++ ) {
+            if ( clique.test(j) ) {
+                adj [ j ] |= clique;
+                adj [ j ].reset(j);
+            }
+        }
+    }
+
+    Array :: Copy(p_tmp, nodes, size);
+}
 
 DSS_NAMESPASE_END
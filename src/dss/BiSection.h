@@ -90,6 +90,45 @@ private:
     void BiSect(long *nodes, long size, long &domA, long &domB);
 };
 
+
+/**
+ * Nested dissection ordering that works directly on the connectivity graph.
+ * The graph is recursively split by vertex separators taken from the level structure
+ * of a pseudo-peripheral node, the separators are numbered after both halves.
+ * Small subgraphs are ordered by the exact minimum degree of their elimination graph.
+ */
+class CNestedDissection
+{
+private:
+    SparseConectivityMtxII *mtx;
+    long n;
+
+    long *p_set;        // stamp of the set being separated
+    long *p_visit;      // stamp of the last breadth first search
+    long *p_level;      // level of the node in the last level structure
+    long *p_part;       // 0 - domain A, 1 - domain B, 2 - separator
+    long *p_queue;
+    long *p_tmp;
+    long set_stamp;
+    long visit_stamp;
+
+public:
+    // subgraphs up to this size are not dissected further
+    static const long leaf_size = 64;
+
+    CNestedDissection(SparseConectivityMtxII *mtx);
+    ~CNestedDissection();
+
+    void NestedDissectionOrder(IntArrayList *order);
+
+private:
+    long LevelStructure(long root, long &n_levels, bool new_search = true);
+    long FindPseudoPeripheralNode(long *nodes, long size, long &n_levels, long &count);
+    bool Separate(long *nodes, long size, long &domA, long &domB);
+    void Arrange(long *nodes, long size, long &domA, long &domB);
+    void OrderLeaf(long *nodes, long size);
+};
+
 DSS_NAMESPASE_END
 
 #endif //_BISECTION_H__
@@ -191,6 +191,7 @@ bool DSSolver :: SetOrderingType(Ordering :: Type otype)
     case Ordering :: ReverseCuthillMcKee:
     case Ordering :: CuthillMcKee:
     case Ordering :: NestedGraphBisection:
+    case Ordering :: NestedDissection:
 #ifdef _LINK_METIS_
     case Ordering :: MetisND:
 #endif
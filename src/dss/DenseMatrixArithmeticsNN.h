@@ -62,7 +62,6 @@ public:
     MathTracer *eMT;
 
 private:
-    double tmp;
     double *p;
 
 public:
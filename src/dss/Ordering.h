@@ -60,6 +60,7 @@ public:
         MetisND = 7,
         ColAMD = 8,
         ApproxMinimumDegreeAA = 9,
+        NestedDissection = 10,
     };
 
 
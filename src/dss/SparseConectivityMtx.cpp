@@ -437,6 +437,16 @@ Ordering *SparseConectivityMtxII :: Get_RecursiveBiSection()
     return new Ordering(order);
 }
 
+Ordering *SparseConectivityMtxII :: Get_NestedDissection()
+{
+    IntArrayList *order = new IntArrayList(n);
+    order->InitIdentity();
+
+    CNestedDissection(this).NestedDissectionOrder(order);
+
+    return new Ordering(order);
+}
+
 #ifdef _LINK_METIS_
 extern "C" void METIS_EdgeND(int *, int *, int *, int *, int *, int *, int *);
 extern "C" void METIS_NodeND(int *, int *, int *, int *, int *, int *, int *);
@@ -490,8 +500,8 @@ Ordering *SparseConectivityMtxII :: Get_MetisDiSection()
     return new Ordering(perm, order);
 
 #else
-    Writeln(" The program was not linked with METIS library, use _LINK_METIS_ directive!");
-    return NULL;
+    Writeln(" The program was not linked with METIS library, built-in nested dissection is used instead.");
+    return Get_NestedDissection();
 
 #endif
 }
@@ -567,6 +577,9 @@ Ordering *SparseConectivityMtxII :: GetOrdering(Ordering :: Type ord)
     if ( ord == Ordering :: MetisND ) {
         return Get_MetisDiSection();
     } else
+    if ( ord == Ordering :: NestedDissection ) {
+        return Get_NestedDissection();
+    } else
     if ( ord == Ordering :: ColAMD ) {
         return Get_ColAMD();
     } else {
@@ -680,6 +693,15 @@ Ordering *SparseConectivityMtxII :: GetPermutationAndPattern(Ordering :: Type or
         Write("...");
         GenerateFillInPresorted(order);
         order->cm = new SparseConectivityMtxII(* this, order);
+    } else if ( ord == Ordering :: NestedDissection ) {
+        Writeln(" ordering            : NestedDissection");
+        Write("Graph ordering optimization : ");
+        clock_t start = MT.ClockStart();
+        order = Get_NestedDissection();
+        Write( MT.MeasureClock(start) );
+        Write("...");
+        GenerateFillInPresorted(order);
+        order->cm = new SparseConectivityMtxII(* this, order);
     } else if ( ord == Ordering :: ColAMD ) {
         Writeln(" ordering            : ColAMD (S.I.Larimore, T.A.Davis)");
         Write("Graph ordering optimization : ");
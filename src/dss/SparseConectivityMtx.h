@@ -88,6 +88,7 @@ public:
     Ordering *Get_Unity();
     Ordering *Get_RecursiveBiSection();
     Ordering *Get_MetisDiSection();
+    Ordering *Get_NestedDissection();
     Ordering *Get_ColAMD();
 
     void GenerateFillInPresorted(Ordering *ord);
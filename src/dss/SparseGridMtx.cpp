@@ -34,6 +34,10 @@
 
 #include "SparseGridMtx.h"
 
+#ifdef _OPENMP
+ #include <omp.h>
+#endif
+
 DSS_NAMESPASE_BEGIN
 
 // Allocates new space according to bskl and reads old matrix with respect
@@ -131,6 +135,119 @@ void SparseGridMtx :: ComputeBlocks()
     }
 }
 
+long SparseGridMtx :: ComputeEliminationLevels(long *level_start, long *level_columns)
+{
+    long *level = new long [ n_blocks ];
+    long n_levels = 0;
+
+    // column bj reads the factorized columns bi listed in its pattern (bi < bj)
+    for ( long bj = 0; bj < n_blocks; bj++ ) {
+        SparseGridColumn &columnJ = * Columns [ bj ];
+        long *columnJentries = columnJ.IndexesUfa->Items;
+        long lj = 0;
+        for ( long idx = 0; idx < columnJ.Entries; idx++ ) {
+            lj = std :: max(lj, level [ columnJentries [ idx ] ] + 1);
+        }
+
+        level [ bj ] = lj;
+        n_levels = std :: max(n_levels, lj + 1);
+    }
+
+    // counting sort, the columns within one level stay in ascending order
+    memset( level_start, 0, ( n_blocks + 1 ) * sizeof( long ) );
+    for ( long bj = 0; bj < n_blocks; bj++ ) {
+        level_start [ level [ bj ] + 1 ]++;
+    }
+
+    for ( long l = 0; l < n_levels; l++ ) {
+        level_start [ l + 1 ] += level_start [ l ];
+    }
+
+    long *level_pos = new long [ n_levels ];
+    memcpy( level_pos, level_start, n_levels * sizeof( long ) );
+    for ( long bj = 0; bj < n_blocks; bj++ ) {
+        level_columns [ level_pos [ level [ bj ] ]++ ] = bj;
+    }
+
+    delete [] level_pos;
+    delete [] level;
+    return n_levels;
+}
+
+void SparseGridMtx :: FactorizeColumns()
+{
+#ifdef _OPENMP
+    int n_threads = omp_get_max_threads();
+    if ( n_threads > 1 && n_blocks > 1 ) {
+        long *level_start = new long [ n_blocks + 1 ];
+        long *level_columns = new long [ n_blocks ];
+        long n_levels = ComputeEliminationLevels(level_start, level_columns);
+
+        // narrow elimination trees (e.g. band matrices) leave nothing to run concurrently
+        if ( n_blocks >= 2 * n_levels ) {
+            // every thread needs its own arithmetics (it keeps a work array) and its own tracer
+            DenseMatrixArithmetics **arith = new DenseMatrixArithmetics * [ n_threads ];
+            for ( int t = 0; t < n_threads; t++ ) {
+                arith [ t ] = DenseMatrixArithmetics :: NewArithmetics(block_size);
+                arith [ t ]->prefered_decomposition = BlockArith->prefered_decomposition;
+                arith [ t ]->MT = * eMT;
+                arith [ t ]->eMT = & arith [ t ]->MT;
+            }
+
+            // the constructors reset the shared counter
+            DenseMatrixArithmetics :: zero_pivots = 0;
+
+ #pragma omp parallel num_threads(n_threads)
+            {
+                DenseMatrixArithmetics *threadArith = arith [ omp_get_thread_num() ];
+                long *p_blockJ_pattern = new long [ n_blocks + 1 ];
+                memset( p_blockJ_pattern, 0, ( n_blocks + 1 ) * sizeof( long ) );
+                double *Atmp = new double [ block_storage ];
+
+                for ( long l = 0; l < n_levels; l++ ) {
+ #pragma omp for schedule(dynamic)
+                    for ( long c = level_start [ l ]; c < level_start [ l + 1 ]; c++ ) {
+                        if ( !eMT->break_flag ) {
+                            this->FactorizeColumn(level_columns [ c ], threadArith, p_blockJ_pattern, Atmp);
+                        }
+                    }
+                }
+
+                delete [] Atmp;
+                delete [] p_blockJ_pattern;
+            }
+
+            for ( int t = 0; t < n_threads; t++ ) {
+                delete arith [ t ];
+            }
+
+            delete [] arith;
+            delete [] level_columns;
+            delete [] level_start;
+            return;
+        }
+
+        delete [] level_columns;
+        delete [] level_start;
+    }
+#endif
+
+    // This is a pattern of blocks in J-th column
+    long *p_blockJ_pattern = new long [ n_blocks + 1 ];
+    memset( p_blockJ_pattern, 0, ( n_blocks + 1 ) * sizeof( long ) );
+    double *Atmp = new double [ block_storage ];
+
+    for ( long bj = 0; bj < n_blocks; bj++ ) {
+        this->FactorizeColumn(bj, BlockArith, p_blockJ_pattern, Atmp);
+        if ( eMT->break_flag ) {
+            break;
+        }
+    }
+
+    delete [] Atmp;
+    delete [] p_blockJ_pattern;
+}
+
 double SparseGridMtx :: GetWaste()
 {
     return 1.0 - ( double ) nonzeros / ( block_storage * blocks );
@@ -120,6 +120,21 @@ public:
     virtual void times(double x);
     virtual void Factorize() = 0;
 
+protected:
+    // Eliminates the block column bj, all columns it depends on must be factorized already.
+    // The pattern array (n_blocks+1 zeroed items) and the Atmp block are scratch space owned
+    // by the caller, so that independent columns can be processed by several threads at once.
+    virtual void FactorizeColumn(long bj, DenseMatrixArithmetics *arith, long *p_blockJ_pattern, double *Atmp) = 0;
+
+    // Factorizes all block columns. With OpenMP the columns are grouped into levels
+    // of the elimination dependencies and the columns of one level are factorized in parallel.
+    void FactorizeColumns();
+
+    // Sorts the block columns into levels, a column depends only on columns of lower levels.
+    // The columns of level l are level_columns[level_start[l]] ... level_columns[level_start[l+1]-1].
+    // Returns the number of levels.
+    long ComputeEliminationLevels(long *level_start, long *level_columns);
+
 public:
 
     virtual void SchurComplementFactorization(int fixed_blocks) = 0;
@@ -116,6 +116,11 @@ public:
     virtual void Factorize();
     virtual void Factorize_Incomplete();
 
+protected:
+    virtual void FactorizeColumn(long bj, DenseMatrixArithmetics *arith, long *p_blockJ_pattern, double *Atmp);
+
+public:
+
     LargeVector *tmp_vector_BS_nodes;
     void SolveLDL_node_perm(const LargeVector &b, LargeVector &x);
 
@@ -85,6 +85,11 @@ public:
     virtual void SolveLV(const LargeVector &b, LargeVector &x);
     virtual void Factorize();
     virtual void Factorize_Incomplete();
+
+protected:
+    virtual void FactorizeColumn(long bj, DenseMatrixArithmetics *arith, long *p_blockJ_pattern, double *Atmp);
+
+public:
     virtual void MultiplyByVector(const LargeVectorAttach &x, LargeVectorAttach &y);
 
     void ForwardSubstL(double *x, long fixed_blocks);
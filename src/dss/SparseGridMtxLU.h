@@ -87,6 +87,11 @@ public:
     virtual void MultiplyByVector(const LargeVectorAttach &x, LargeVectorAttach &y);
     virtual void Factorize();
 
+protected:
+    virtual void FactorizeColumn(long bj, DenseMatrixArithmetics *arith, long *p_blockJ_pattern, double *Atmp);
+
+public:
+
     void BackSubstU(double *x, long fixed_blocks);
     void ForwardSubstL(double *x, long fixed_blocks);
 
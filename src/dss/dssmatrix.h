@@ -42,6 +42,7 @@
 #include "SparseMatrixF.h"
 
 #include <memory>
+#include <vector>
 
 #define _IFT_DSSMatrix_Name "dss"
 
@@ -72,6 +73,8 @@ protected:
     std:: unique_ptr<unsigned long[]> rowind_;
     /// Pointer to columns
     std:: unique_ptr<unsigned long[]> colptr_;
+    /// Block to equation mapping used by the current symbolic factorization
+    std :: vector< long > mcn_;
     /// Flag indicating whether factorized.
     bool isFactorized;
     /// type of storage & factorization
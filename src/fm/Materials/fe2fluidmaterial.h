@@ -46,6 +46,7 @@
 //@{
 #define _IFT_FE2FluidMaterial_Name "fe2fluidmaterial"
 #define _IFT_FE2FluidMaterial_fileName "inputfile"
+#define _IFT_FE2FluidMaterial_cacheTolerance "rvecachetol"
 //@}
 
 namespace oofem {
@@ -73,6 +74,12 @@ protected:
 
     bool oldTangents;
 
+    /// Input (strain rate and pressure) and response of the last solution of the RVE.
+    FloatArray rveStrainRate, rveStress;
+    double rvePressure = 0., rveVolume = 0.;
+    /// Set if the temporary state reuses the last RVE solution for a nearby input, the RVE is solved for it when the state is accepted.
+    bool reused = false;
+
 public:
     /**
      * Creates new material status.
@@ -105,6 +112,17 @@ public:
     double givePressure() { return this->pressure; }
     void letPressureBe(double val) { this->pressure = val; }
 
+    /**
+     * Solves the RVE for given macro strain rate and pressure and records the solution.
+     * @return Deviatoric stress and volumetric response.
+     */
+    std::pair<FloatArrayF<6>, double> solveRVE(const FloatArrayF<6> &eps, double pressure, TimeStep *tStep);
+    /**
+     * Gives the last solution of the RVE if the input is within given relative tolerance of it.
+     * @return True if the solution is reused, false if the RVE has to be solved.
+     */
+    bool giveCachedResponse(std::pair<FloatArrayF<6>, double> &answer, const FloatArrayF<6> &eps, double pressure, double tol);
+
     void printOutputAt(FILE *file, TimeStep *tStep) const override;
 
     void initTempStatus() override;
@@ -132,6 +150,8 @@ class FE2FluidMaterial : public FluidDynamicMaterial
 private:
     std :: string inputfile;
     static int n;
+    /// Relative change of input within which the last RVE solution is reused (zero disables the reuse).
+    double cacheTolerance = 0.;
 
 public:
     /**
@@ -43,6 +43,9 @@
 #define delaunaytrinagulator_h
 
 #include <list>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
 #include "contextioresulttype.h"
 #include "timer.h"
 #include "octreelocalizert.h"
@@ -72,6 +75,8 @@ protected:
     double alphaValue;
     // Number of nodes
     int nnode;
+    /// Insert the nodes in biased randomized rounds sorted along a Hilbert curve instead of by their numbers
+    bool sortedInsertion;
     // Option 2: setting bounds for computed Alpha
     //double minAlpha;
     //double maxAlpha;
@@ -91,14 +96,16 @@ protected:
     std :: list< AlphaEdge2D * >alphaShapeEdgeList;
 
     /// contains all edges of the triangulation
-    std :: list< AlphaEdge2D * >edgeList;
+    std :: vector< AlphaEdge2D * >edgeList;
+    /// Edges of the triangulation shared by one triangle so far, hashed by their node numbers
+    std :: unordered_map< std :: uint64_t, AlphaEdge2D * >openEdges;
 
     /// Octree with Delaunay triangles allowing fast search
     OctreeSpatialLocalizerT< DelaunayTriangle * >triangleOctree;
 
 public:
     /// Constructor
-    DelaunayTriangulator(Domain *d, double setAlpha);
+    DelaunayTriangulator(Domain *d, double setAlpha, bool sortedInsertion = false);
     /// Destructor
     ~DelaunayTriangulator();
 
@@ -107,7 +114,10 @@ public:
 
 private:
     /// Edge is added to the polygon only if it's not contained. Otherwise both are removed (edge shared by two non-Delaunay triangles).
-    void addUniqueEdgeToPolygon(Edge2D edge, std :: list< Edge2D > &polygon);
+    void addUniqueEdgeToPolygon(Edge2D edge, std :: vector< Edge2D > &polygon);
+
+    /// Gives the order in which the active nodes are inserted
+    void giveInsertionOrder(std :: vector< int > &order);
 
     /// Identifies the bounding box of pfemparticles and creates initial triangulation consisting of 2 triangles conecting bounding box nodes
     void buildInitialBBXMesh(InsertTriangleBasedOnCircumcircle &tInsert);
@@ -119,6 +129,7 @@ private:
 
     /**
      * Fills the edgeList with unique alphaEdges. If an edge is already contained a pointer to it is returned and inserted edge is removed.
+     * Edges are looked up in a hash of the edges shared by one triangle so far.
      */
     AlphaEdge2D *giveBackEdgeIfAlreadyContainedInList(AlphaEdge2D &alphaEdge);
 
@@ -129,9 +140,9 @@ private:
     void initializeTimers();
 
     /// Looks for non-Delaunay triangles in octree and creates a polygon
-    void findNonDelaunayTriangles(int insertedNode, InsertTriangleBasedOnCircumcircle &tInsert, std :: list< Edge2D > &polygon);
+    void findNonDelaunayTriangles(int insertedNode, InsertTriangleBasedOnCircumcircle &tInsert, std :: vector< Edge2D > &polygon);
     /// Retriangulates the polygon
-    void meshPolygon(int insertedNode, InsertTriangleBasedOnCircumcircle &tInsert, std :: list< Edge2D > &polygon);
+    void meshPolygon(int insertedNode, InsertTriangleBasedOnCircumcircle &tInsert, std :: vector< Edge2D > &polygon);
     /// Prints the time report
     void giveTimeReport();
     /// Iterates through generalTringleList und removes non-valid ones or those containing bounding box nodes
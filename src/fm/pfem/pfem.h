@@ -51,6 +51,7 @@
 #define _IFT_PFEM_deltat "deltat"
 #define _IFT_PFEM_mindeltat "mindeltat"
 #define _IFT_PFEM_alphashapecoef "alphashapecoef"
+#define _IFT_PFEM_sortedInsertion "sortedinsertion"
 #define _IFT_PFEM_particalRemovalRatio "removalratio"
 #define _IFT_PFEM_printVolumeReport "volumereport"
 #define _IFT_PFEM_discretizationScheme "scheme"
@@ -152,6 +153,8 @@ protected:
     double minDeltaT;
     /// Value of alpha coefficient for the boundary recognition
     double alphaShapeCoef;
+    /// Insert the particles into the triangulation in spatially sorted rounds
+    bool sortedInsertion;
     /// Element side ratio for the removal of the close partices
     double particleRemovalRatio;
     /// Convergence tolerance.
@@ -0,0 +1,97 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef asyncfilewriter_h
+#define asyncfilewriter_h
+
+#include "oofemcfg.h"
+
+#include <functional>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+namespace oofem {
+/**
+ * Executes file writing jobs on a single background thread.
+ * Jobs are executed one at a time, in the order in which they were pushed, so files written for
+ * consecutive solution steps are completed in the order of the steps. The number of pending jobs is bounded;
+ * push blocks when the queue is full, so that the buffered data cannot grow without limit when
+ * the writing is slower than the computation.
+ * An exception thrown by a job is rethrown by the next call to push or flush.
+ */
+class OOFEM_EXPORT AsyncFileWriter
+{
+protected:
+    /// Jobs waiting for execution.
+    std::deque< std::function< void() > >jobs;
+    /// Maximum number of pending jobs.
+    std::size_t maxPendingJobs;
+    /// Set when the job in front of the queue is executed.
+    bool busy;
+    /// Set when the writer thread is requested to finish.
+    bool finished;
+    /// Exception thrown by the last failed job.
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::thread thread;
+
+public:
+    /**
+     * Constructor. Starts the writer thread.
+     * @param maxPendingJobs Maximum number of jobs waiting in the queue.
+     */
+    AsyncFileWriter(std::size_t maxPendingJobs = 2);
+    /// Destructor. Executes the remaining jobs and stops the writer thread.
+    ~AsyncFileWriter();
+
+    AsyncFileWriter(const AsyncFileWriter &) = delete;
+    AsyncFileWriter &operator=(const AsyncFileWriter &) = delete;
+
+    /// Adds a job at the end of the queue.
+    void push(std::function< void() >job);
+    /// Waits until all pushed jobs have been executed.
+    void flush();
+
+protected:
+    /// Main loop of the writer thread.
+    void run();
+    /// Rethrows the exception of a failed job (mutex must be locked).
+    void checkError();
+};
+} // end namespace oofem
+#endif // asyncfilewriter_h
@@ -0,0 +1,265 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef bvhlocalizer_h
+#define bvhlocalizer_h
+
+#include "oofemcfg.h"
+#include "spatiallocalizer.h"
+
+#include <vector>
+#include <cmath>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace oofem {
+class GaussPoint;
+
+/// Max number of items in leaf of bounding volume hierarchy
+#define BVH_LEAF_SIZE 8
+
+/**
+ * Bounding volume hierarchy of axis aligned boxes (points are boxes of zero size), stored in contiguous arrays.
+ * Tree nodes are stored in depth-first order, so that the left child immediately follows its parent
+ * and only the index of the right child is kept. Items are permuted so that each leaf refers to
+ * contiguous range of items. The tree is built by recursive median split along the longest axis.
+ * All queries are read only and can be invoked concurrently.
+ */
+class OOFEM_EXPORT BVHTree
+{
+public:
+    /// Tree node record.
+    struct BVHNode {
+        double bmin [ 3 ], bmax [ 3 ];
+        /// Index of first item for leaf, index of right child for internal node.
+        int first;
+        /// Number of items, zero for internal node.
+        int count;
+    };
+
+protected:
+    /// Tree nodes, root is the first one.
+    std :: vector< BVHNode >nodes;
+    /// Item identifiers in leaf order.
+    std :: vector< int >itemIds;
+    /// Item boxes in leaf order (min followed by max, 6 values per item).
+    std :: vector< double >itemBoxes;
+
+public:
+    BVHTree() { }
+
+    /**
+     * Builds the tree.
+     * @param ids Item identifiers.
+     * @param boxes Item boxes, 6 values per item (min and max coordinates) in the order of ids.
+     */
+    void build(const std :: vector< int > &ids, const std :: vector< double > &boxes);
+    /// Clears the receiver.
+    void clear();
+    /// Returns true if there are no items.
+    bool isEmpty() const { return itemIds.empty(); }
+    /// Returns the number of items.
+    int giveNumberOfItems() const { return ( int ) itemIds.size(); }
+
+    /// Returns the distance between given box and point (zero if point is inside), only first nd components are considered.
+    static double boxDistance(const double *bmin, const double *bmax, const double *c, int nd)
+    {
+        double d2 = 0.;
+        for ( int i = 0; i < nd; i++ ) {
+            double d = c [ i ] < bmin [ i ] ? bmin [ i ] - c [ i ] : ( c [ i ] > bmax [ i ] ? c [ i ] - bmax [ i ] : 0. );
+            d2 += d * d;
+        }
+        return sqrt(d2);
+    }
+
+    /**
+     * Invokes fn(id, box) for all items, whose boxes intersect given box.
+     * Only first nd components are considered.
+     */
+    template< class Fn >
+    void forItemsInBox(const double *bmin, const double *bmax, int nd, Fn fn) const
+    {
+        if ( nodes.empty() ) {
+            return;
+        }
+        int stack [ 64 ], top = 0;
+        stack [ top++ ] = 0;
+        while ( top ) {
+            const BVHNode &node = nodes [ stack [ --top ] ];
+            if ( !overlaps(node.bmin, node.bmax, bmin, bmax, nd) ) {
+                continue;
+            }
+            if ( node.count ) {
+                for ( int i = node.first; i < node.first + node.count; i++ ) {
+                    const double *box = & itemBoxes [ 6 * i ];
+                    if ( overlaps(box, box + 3, bmin, bmax, nd) ) {
+                        fn(itemIds [ i ], box);
+                    }
+                }
+            } else {
+                stack [ top++ ] = node.first;
+                stack [ top++ ] = ( int ) ( & node - nodes.data() ) + 1;
+            }
+        }
+    }
+
+    /**
+     * Branch and bound search of the item closest to given point. Invokes fn(id, box, bound) for all items
+     * whose boxes are not farther than bound; fn is expected to evaluate the true distance of item and to
+     * decrease the bound if a closer item is found. Closer subtrees are visited first.
+     * Only first nd components are considered.
+     */
+    template< class Fn >
+    void forNearestItems(const double *c, int nd, double &bound, Fn fn) const
+    {
+        if ( nodes.empty() ) {
+            return;
+        }
+        int stack [ 64 ], top = 0;
+        stack [ top++ ] = 0;
+        while ( top ) {
+            int inode = stack [ --top ];
+            const BVHNode &node = nodes [ inode ];
+            if ( boxDistance(node.bmin, node.bmax, c, nd) > bound ) {
+                continue;
+            }
+            if ( node.count ) {
+                for ( int i = node.first; i < node.first + node.count; i++ ) {
+                    const double *box = & itemBoxes [ 6 * i ];
+                    if ( boxDistance(box, box + 3, c, nd) <= bound ) {
+                        fn(itemIds [ i ], box, bound);
+                    }
+                }
+            } else {
+                int left = inode + 1, right = node.first;
+                double dl = boxDistance(nodes [ left ].bmin, nodes [ left ].bmax, c, nd);
+                double dr = boxDistance(nodes [ right ].bmin, nodes [ right ].bmax, c, nd);
+                // push the farther child first, so that the closer one is processed first
+                if ( dl <= dr ) {
+                    stack [ top++ ] = right;
+                    stack [ top++ ] = left;
+                } else {
+                    stack [ top++ ] = left;
+                    stack [ top++ ] = right;
+                }
+            }
+        }
+    }
+
+protected:
+    static bool overlaps(const double *amin, const double *amax, const double *bmin, const double *bmax, int nd)
+    {
+        for ( int i = 0; i < nd; i++ ) {
+            if ( amin [ i ] > bmax [ i ] || amax [ i ] < bmin [ i ] ) {
+                return false;
+            }
+        }
+        return true;
+    }
+    int buildNode(std :: vector< int > &perm, int begin, int end, const std :: vector< double > &boxes);
+};
+
+
+/**
+ * Spatial localizer based on bounding volume hierarchies. Separate trees are built for nodes, integration
+ * points of default integration rules (and cohesive zone integration points of XFEM elements, if requested)
+ * and element bounding boxes. All trees are stored in contiguous arrays and the integration point coordinates
+ * are cached, so that the queries do not need to evaluate them again. The trees are built on first request,
+ * the queries are thread safe, so that the batched point queries of SpatialLocalizer can run in parallel.
+ * Compared to OctreeSpatialLocalizer, the results differ only in the choice among equivalent candidates
+ * (e.g. point located on element boundary is assigned to element with lowest number).
+ */
+class OOFEM_EXPORT BVHSpatialLocalizer : public SpatialLocalizer
+{
+protected:
+    /// Tree of nodes (item ids are node numbers).
+    BVHTree nodeTree;
+    /// Tree of integration points (item ids are indices into ipList).
+    BVHTree ipTree;
+    /// Tree of cohesive zone integration points (item ids are indices into czList).
+    BVHTree czTree;
+    /// Tree of element bounding boxes (item ids are element numbers).
+    BVHTree elementTree;
+    /// Integration points in ipTree.
+    std :: vector< GaussPoint * >ipList;
+    /// Cohesive zone integration points in czTree.
+    std :: vector< GaussPoint * >czList;
+    /// Number of spatial dimensions of the mesh (number of node coordinates).
+    int nsd;
+    bool initialized, ipTreeInitialized, czTreeInitialized, elementTreeInitialized;
+#ifdef _OPENMP
+    omp_lock_t initLock;
+#endif
+
+public:
+    /// Constructor
+    BVHSpatialLocalizer(Domain * d);
+    /// Destructor
+    virtual ~BVHSpatialLocalizer();
+
+    int init(bool force = false) override;
+
+    Element *giveElementContainingPoint(const FloatArray &coords, const IntArray *regionList = nullptr) override;
+    Element *giveElementContainingPoint(const FloatArray &coords, const Set &eset) override;
+    Element *giveElementClosestToPoint(FloatArray &lcoords, FloatArray &closest, const FloatArray &gcoords, int region = 0) override;
+
+    GaussPoint *giveClosestIP(const FloatArray &coords, int region, bool iCohesiveZoneGP = false) override;
+    GaussPoint *giveClosestIP(const FloatArray &coords, Set &elemSet, bool iCohesiveZoneGP = false) override;
+
+    void giveAllElementsWithIpWithinBox_EvenIfEmpty(elementContainerType &elemSet, const FloatArray &coords, const double radius) override { giveAllElementsWithIpWithinBox_EvenIfEmpty(elemSet, coords, radius, false); }
+    void giveAllElementsWithIpWithinBox(elementContainerType &elemSet, const FloatArray &coords, const double radius) override { giveAllElementsWithIpWithinBox(elemSet, coords, radius, false); }
+    void giveAllElementsWithIpWithinBox_EvenIfEmpty(elementContainerType &elemSet, const FloatArray &coords, const double radius, bool iCohesiveZoneGP);
+    void giveAllElementsWithIpWithinBox(elementContainerType &elemSet, const FloatArray &coords, const double radius, bool iCohesiveZoneGP);
+
+    void giveAllNodesWithinBox(nodeContainerType &nodeList, const FloatArray &coords, const double radius) override;
+    Node *giveNodeClosestToPoint(const FloatArray &coords, double maxDist) override;
+
+    const char *giveClassName() const override { return "BVHSpatialLocalizer"; }
+
+protected:
+    void buildNodeTree();
+    void initIPTree();
+    void initCZTree();
+    void initElementTree();
+    /// Converts coordinates into array of 3 components, returns the number of components to be considered.
+    int giveQueryCoordinates(const FloatArray &coords, double *c) const;
+    template< class Filter >
+    Element *giveElementContainingPoint(const FloatArray &coords, Filter filter);
+    template< class Filter >
+    GaussPoint *giveClosestIP(const FloatArray &coords, bool iCohesiveZoneGP, Filter filter);
+};
+} // end namespace oofem
+#endif // bvhlocalizer_h
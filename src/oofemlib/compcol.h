@@ -92,6 +92,13 @@ protected:
     int base;              // index base: offset of first element
     int nz;                // number of nonzeros
 
+    /// Row pointers of the row-wise index of stored entries (nRows+1 elements), used by the threaded product.
+    IntArray rowIndexPtr;
+    /// Column of each entry in the row-wise index (sorted within each row).
+    IntArray rowIndexCol;
+    /// Position of each entry of the row-wise index in val.
+    IntArray rowIndexPos;
+
 public:
     /** Constructor. Before any operation an internal profile must be built.
      * @see buildInternalStructure
@@ -112,6 +119,7 @@ public:
     int buildInternalStructure(EngngModel *, int, const UnknownNumberingScheme &s) override;
     int assemble(const IntArray &loc, const FloatMatrix &mat) override;
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
+    bool supportsConcurrentAssembly() const override { return true; }
     bool canBeFactorized() const override { return false; }
     void zero() override;
     double &at(int i, int j) override;
@@ -135,6 +143,9 @@ public:
     const int &col_ptr(int i) const { return colptr[i]; }
 
 protected:
+    /// Builds the row-wise index of the stored entries, to be called when the sparsity pattern changes.
+    void buildRowIndex();
+
     /***********************************/
     /*  General access function (slow) */
     /***********************************/
@@ -0,0 +1,98 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef contextblockfile_h
+#define contextblockfile_h
+
+#include "oofemcfg.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace oofem {
+class MemoryDataStream;
+
+/// Size of (uncompressed) block of context file.
+#define CONTEXT_BLOCK_SIZE ( 1 << 20 )
+
+/**
+ * Block structured context file. The serialized context is split into blocks of fixed size, which are
+ * compressed (if zlib support is available) concurrently and written in one pass. In incremental mode,
+ * the blocks identical to those of previously written file are not stored again, the file keeps the
+ * reference to the file and position, where the block data are stored. Therefore, the files referenced by
+ * incremental context file must be kept. The blocks are identified by pair of 64-bit hashes of their content.
+ * The restored data are bit-identical to the serialized context.
+ */
+class OOFEM_EXPORT ContextBlockFile
+{
+protected:
+    /// Record describing stored block.
+    struct BlockRecord {
+        std :: uint64_t hash [ 2 ];
+        int rawSize;
+        int storedSize;
+        bool compressed;
+        /// File, where the block data are stored.
+        std :: string owner;
+        /// Position of block data in owner file.
+        std :: uint64_t offset;
+    };
+    /// Blocks of last written file.
+    std :: vector< BlockRecord >lastBlocks;
+
+public:
+    ContextBlockFile() { }
+
+    /**
+     * Writes the data into block file.
+     * @param fname File name.
+     * @param data Serialized context.
+     * @param compress If true, the blocks are compressed.
+     * @param incremental If true, the blocks not changed since the last written file are only referenced.
+     */
+    void write(const std :: string &fname, const MemoryDataStream &data, bool compress, bool incremental);
+    /**
+     * Reads the block file.
+     * @param fname File name.
+     * @param answer Stream receiving the data.
+     */
+    static void read(const std :: string &fname, MemoryDataStream &answer);
+    /// Returns true if given file is block context file.
+    static bool isBlockFile(const std :: string &fname);
+    /// Forgets the last written file, the next file will be written completely.
+    void clear() { lastBlocks.clear(); }
+};
+} // end namespace oofem
+#endif // contextblockfile_h
@@ -41,6 +41,8 @@
 #include <cstdio>
 #include <exception>
 #include <stdexcept>
+#include <vector>
+#include <cstddef>
 
 namespace oofem {
 /**
@@ -124,6 +126,19 @@ public:
     virtual int givePackSizeOfBool(int count) = 0;
     virtual int givePackSizeOfLong(int count) = 0;
     //@}
+
+    /**
+     * @name Bulk access.
+     * Streams keeping their data in contiguous memory give direct access to the next nbytes of the stream
+     * and advance their position, so that large blocks can be processed in place without extra copy.
+     * Other streams (files, MPI buffers) return nullptr and the typed methods have to be used.
+     */
+    //@{
+    /// Returns pointer to next nbytes of data to read, nullptr if not supported or not enough data.
+    virtual const char *giveReadSpan(std :: size_t nbytes) { return nullptr; }
+    /// Reserves nbytes at the end of stream and returns pointer to it, nullptr if not supported.
+    virtual char *giveWriteSpan(std :: size_t nbytes) { return nullptr; }
+    //@}
 };
 
 
@@ -176,5 +191,128 @@ public:
     int givePackSizeOfLong(int count) override;
 };
 
+
+/**
+ * Implementation of DataStream storing the data in growable memory buffer.
+ * Used to serialize the context in one piece, so that it can be written to file in large blocks
+ * (and compressed), instead of issuing file operation for every small array.
+ */
+class OOFEM_EXPORT MemoryDataStream : public DataStream
+{
+protected:
+    /// Stored data.
+    std :: vector< char >buffer;
+    /// Current read position.
+    std :: size_t pos;
+
+public:
+    /// Constructor, creates empty stream.
+    MemoryDataStream() : buffer(), pos(0) { }
+    virtual ~MemoryDataStream() { }
+
+    using DataStream :: read;
+    using DataStream :: write;
+    int read(int *data, int count) override { return this->readBytes(data, sizeof( int ) * count); }
+    int read(unsigned long *data, int count) override { return this->readBytes(data, sizeof( unsigned long ) * count); }
+    int read(long *data, int count) override { return this->readBytes(data, sizeof( long ) * count); }
+    int read(double *data, int count) override { return this->readBytes(data, sizeof( double ) * count); }
+    int read(char *data, int count) override { return this->readBytes(data, sizeof( char ) * count); }
+    int read(bool &data) override { return this->readBytes(& data, sizeof( bool )); }
+
+    int write(const int *data, int count) override { return this->writeBytes(data, sizeof( int ) * count); }
+    int write(const unsigned long *data, int count) override { return this->writeBytes(data, sizeof( unsigned long ) * count); }
+    int write(const long *data, int count) override { return this->writeBytes(data, sizeof( long ) * count); }
+    int write(const double *data, int count) override { return this->writeBytes(data, sizeof( double ) * count); }
+    int write(const char *data, int count) override { return this->writeBytes(data, sizeof( char ) * count); }
+    int write(bool data) override { return this->writeBytes(& data, sizeof( bool )); }
+
+    int givePackSizeOfInt(int count) override { return sizeof( int ) * count; }
+    int givePackSizeOfDouble(int count) override { return sizeof( double ) * count; }
+    int givePackSizeOfChar(int count) override { return sizeof( char ) * count; }
+    int givePackSizeOfBool(int count) override { return sizeof( bool ) * count; }
+    int givePackSizeOfLong(int count) override { return sizeof( long ) * count; }
+
+    const char *giveReadSpan(std :: size_t nbytes) override;
+    char *giveWriteSpan(std :: size_t nbytes) override;
+
+    /// Appends the content of given stream.
+    void append(const MemoryDataStream &src) { buffer.insert( buffer.end(), src.buffer.begin(), src.buffer.end() ); }
+    /// Returns the stored data.
+    std :: vector< char > &giveBuffer() { return buffer; }
+    const std :: vector< char > &giveBuffer() const { return buffer; }
+    /// Returns the size of stored data in bytes.
+    std :: size_t giveSize() const { return buffer.size(); }
+    /// Moves the read position to the beginning of the stream.
+    void rewind() { pos = 0; }
+
+protected:
+    int readBytes(void *data, std :: size_t n);
+    int writeBytes(const void *data, std :: size_t n);
+};
+
+
+/**
+ * Read only DataStream over memory mapped file.
+ * The values are copied directly from the mapped pages instead of going through buffered stdio call
+ * for every value, and large blocks can be accessed in place using giveReadSpan.
+ * On platforms without mmap, the whole file is read into memory at once.
+ */
+class OOFEM_EXPORT MappedFileDataStream : public DataStream
+{
+protected:
+    /// Start of mapped data.
+    const char *data;
+    /// Size of mapped data.
+    std :: size_t size;
+    /// Current read position.
+    std :: size_t pos;
+    /// Storage used when the file can not be mapped.
+    std :: vector< char >fallback;
+    /// Filename.
+    std :: string filename;
+
+public:
+    /// Constructor, maps the given file. Throws FileDataStream::CantOpen if the file can not be opened.
+    MappedFileDataStream(std :: string filename);
+    MappedFileDataStream(const MappedFileDataStream &) = delete;
+    MappedFileDataStream &operator = ( const MappedFileDataStream & ) = delete;
+    /// Destructor, unmaps the file.
+    virtual ~MappedFileDataStream();
+
+    using DataStream :: read;
+    using DataStream :: write;
+    int read(int *data, int count) override { return this->readBytes(data, sizeof( int ) * count); }
+    int read(unsigned long *data, int count) override { return this->readBytes(data, sizeof( unsigned long ) * count); }
+    int read(long *data, int count) override { return this->readBytes(data, sizeof( long ) * count); }
+    int read(double *data, int count) override { return this->readBytes(data, sizeof( double ) * count); }
+    int read(char *data, int count) override { return this->readBytes(data, sizeof( char ) * count); }
+    int read(bool &data) override { return this->readBytes(& data, sizeof( bool )); }
+
+    /// Stream is read only, all write methods fail.
+    int write(const int *data, int count) override { return 0; }
+    int write(const unsigned long *data, int count) override { return 0; }
+    int write(const long *data, int count) override { return 0; }
+    int write(const double *data, int count) override { return 0; }
+    int write(const char *data, int count) override { return 0; }
+    int write(bool data) override { return 0; }
+
+    int givePackSizeOfInt(int count) override { return sizeof( int ) * count; }
+    int givePackSizeOfDouble(int count) override { return sizeof( double ) * count; }
+    int givePackSizeOfChar(int count) override { return sizeof( char ) * count; }
+    int givePackSizeOfBool(int count) override { return sizeof( bool ) * count; }
+    int givePackSizeOfLong(int count) override { return sizeof( long ) * count; }
+
+    const char *giveReadSpan(std :: size_t nbytes) override;
+
+    /// Returns the size of the file in bytes.
+    std :: size_t giveSize() const { return size; }
+    /// Returns current read position.
+    std :: size_t givePosition() const { return pos; }
+    /// Moves the read position, returns nonzero if successful.
+    int seek(std :: size_t newPos);
+
+protected:
+    int readBytes(void *dest, std :: size_t n);
+};
 } // end namespace oofem
 #endif // datastream_h
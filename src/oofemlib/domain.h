@@ -69,6 +69,7 @@
 #define _IFT_Domain_numberOfSpatialDimensions "nsd" ///< [in,optional] Specifies how many spatial dimensions the domain has.
 #define _IFT_Domain_nfracman "nfracman" /// [in,optional] Specifies if there is a fracture manager.
 #define _IFT_Domain_axisymmetric "axisymm" /// [optional] Specifies if the problem is axisymmetric.
+#define _IFT_Domain_localizer "localizer" /// [optional] Spatial localizer type (0 = octree (default), 1 = bounding volume hierarchy).
 //@}
 
 namespace oofem {
@@ -171,6 +172,8 @@ private:
     /// Number of spatial dimensions
     int nsd;
     bool axisymm;
+    /// Spatial localizer type (0 = octree, 1 = bounding volume hierarchy).
+    int localizerType;
     /// nodal recovery object associated to receiver.
     std :: unique_ptr< NodalRecoveryModel > smoother; ///@todo I don't see why this has to be stored, and there is only one? /Mikael
 
@@ -53,6 +53,7 @@
 #include "contextoutputmode.h"
 #include "contextfilemode.h"
 #include "contextioresulttype.h"
+#include "contextblockfile.h"
 #include "metastep.h"
 #include "parallelcontext.h"
 #include "exportmodulemanager.h"
@@ -70,6 +71,8 @@
 //@{
 #define _IFT_EngngModel_nsteps "nsteps"
 #define _IFT_EngngModel_contextoutputstep "contextoutputstep"
+#define _IFT_EngngModel_contextCompress "contextcompress" ///< [optional] Context files are written in compressed blocks.
+#define _IFT_EngngModel_contextIncremental "contextincremental" ///< [optional] Only blocks changed since the last context file are stored.
 #define _IFT_EngngModel_renumberFlag "renumber"
 #define _IFT_EngngModel_profileOpt "profileopt"
 #define _IFT_EngngModel_nmsteps "nmsteps"
@@ -85,6 +88,8 @@
 #define _IFT_EngngModel_smtype "smtype"
 
 #define _IFT_EngngModel_suppressOutput "suppress_output" // Suppress writing to .out file
+#define _IFT_EngngModel_threadCheck "threadcheck" // Checks thread safety of element and material evaluation
+#define _IFT_EngngModel_geometryCache "geometrycache" ///< [optional] Elements cache geometric matrices of their integration points.
 
 //@}
 
@@ -248,6 +253,10 @@ protected:
     /// Domain context output mode.
     ContextOutputMode contextOutputMode;
     int contextOutputStep;
+    /// Flags determining whether context files are block structured, compressed and incremental.
+    bool contextCompress, contextIncremental;
+    /// Writer of block structured context files (keeps the blocks of last file for incremental mode).
+    ContextBlockFile contextBlockFile;
 
     /// Export module manager.
     ExportModuleManager exportModuleManager;
@@ -317,6 +326,14 @@ protected:
 
     /// Flag for suppressing output to file.
     bool suppressOutput;
+    /**
+     * Flag for checked mode of the concurrent element evaluation.
+     * Materials not supporting concurrent evaluation are reported, and the element vectors computed concurrently
+     * are compared to the sequentially computed ones to reveal shared mutable state.
+     */
+    bool threadCheck;
+    /// Flag determining whether elements may cache geometric data (such as strain-displacement matrices) of their integration points.
+    bool geometryCache;
 
     std::string simulationDescription;
 
@@ -349,6 +366,8 @@ public:
     const std :: string &giveDescription() const { return simulationDescription; }
     const time_t &giveStartTime() { return startTime; }
     bool giveSuppressOutput() const { return suppressOutput; }
+    /// Returns true if elements may cache geometry dependent data of their integration points.
+    bool giveGeometryCacheFlag() const { return geometryCache; }
 
     /** Service for accessing ErrorEstimator corresponding to particular domain */
     virtual ErrorEstimator *giveDomainErrorEstimator(int n) { return defaultErrEstimator.get(); }
@@ -469,6 +488,15 @@ public:
      * Saves context of given solution step, if required (determined using this->giveContextOutputMode() method).
      */
     void saveStepContext(TimeStep *tStep, ContextMode mode);
+    /**
+     * Restores context of given solution step from corresponding context file.
+     * Both the plain and block structured (compressed) context files are recognized.
+     * @param tStepNumber Solution step number.
+     * @param stepVersion Solution step version.
+     * @param mode Context mode.
+     * @exception FileDataStream::CantOpen If the context file can not be opened.
+     */
+    void restoreStepContext(int tStepNumber, int stepVersion, ContextMode mode);
     /**
      * Updates internal state after finishing time step. (for example total values may be
      * updated according to previously solved increments). Then element values are also updated
@@ -1144,6 +1172,12 @@ public:
     EngngModel *giveEngngModel() { return this; }
     virtual bool isElementActivated( int elemNum ) { return true; }
     virtual bool isElementActivated( Element *e ) { return true; }
+    /**
+     * Tests if the elements of given domain can be evaluated concurrently (by several threads).
+     * This requires all materials of the domain to support concurrent evaluation.
+     * @see Material::supportsConcurrentEvaluation
+     */
+    bool allowsConcurrentEvaluation(Domain *d);
 
 
 #ifdef __OOFEG
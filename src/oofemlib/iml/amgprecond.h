@@ -0,0 +1,125 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef amgprecond_h
+#define amgprecond_h
+
+#include "floatarray.h"
+#include "floatmatrix.h"
+#include "intarray.h"
+#include "precond.h"
+
+#include <vector>
+
+///@name Input fields for AMGPreconditioner
+//@{
+#define _IFT_AMGPreconditioner_theta "amgtheta"
+#define _IFT_AMGPreconditioner_coarsesize "amgcoarse"
+#define _IFT_AMGPreconditioner_maxlevels "amglevels"
+#define _IFT_AMGPreconditioner_sweeps "amgsweeps"
+//@}
+
+namespace oofem {
+/**
+ * Smoothed aggregation algebraic multigrid preconditioner.
+ * The hierarchy is built from the matrix entries only: unknowns are grouped into aggregates of strongly
+ * coupled neighbours, the piecewise constant tentative prolongator is smoothed by one damped Jacobi step
+ * and the coarse operators are obtained as Galerkin products @f$ R A P @f$ with @f$ R = P^{\mathrm{T}} @f$.
+ * One application is a V-cycle with forward Gauss-Seidel pre-smoothing and backward Gauss-Seidel
+ * post-smoothing, which keeps the preconditioner symmetric for use with CG.
+ * The coarsest level is solved by a dense inverse.
+ * Works with any storage supported by Preconditioner::giveCompressedRows.
+ */
+class OOFEM_EXPORT AMGPreconditioner : public Preconditioner
+{
+protected:
+    /// Operator and transfer operators of one level of the hierarchy (all in 0-based CSR).
+    struct Level {
+        int n = 0;
+        IntArray rowptr, colind;
+        FloatArray val;
+        /// Inverse of the diagonal.
+        FloatArray invdiag;
+        /// Prolongation from the next coarser level.
+        IntArray prowptr, pcolind;
+        FloatArray pval;
+        /// Restriction to the next coarser level.
+        IntArray rrowptr, rcolind;
+        FloatArray rval;
+    };
+
+    std :: vector< Level > levels;
+    /// Dense inverse of the coarsest operator (empty if the coarsest level is smoothed only).
+    FloatMatrix coarseInv;
+
+    /// Strength of connection threshold.
+    double theta;
+    /// Size of the level that is solved directly.
+    int coarseSize;
+    /// Maximum number of levels.
+    int maxLevels;
+    /// Number of smoothing sweeps.
+    int sweeps;
+
+public:
+    /// Constructor. Initializes the the receiver (constructs the precontioning matrix M) of given matrix.
+    AMGPreconditioner(const SparseMtrx & A, InputRecord & attributes);
+    /// Constructor. The user should call initializeFrom and init services in this given order to ensure consistency.
+    AMGPreconditioner() : Preconditioner(), theta(0.08), coarseSize(500), maxLevels(10), sweeps(1) { }
+    /// Destructor.
+    virtual ~AMGPreconditioner(void) { }
+
+    void init(const SparseMtrx &a) override;
+
+    void solve(const FloatArray &rhs, FloatArray &solution) const override;
+    void trans_solve(const FloatArray &rhs, FloatArray &solution) const override;
+
+    const char *giveClassName() const override { return "SA-AMG"; }
+    void initializeFrom(InputRecord &ir) override;
+
+protected:
+    /// Computes the inverse diagonal of given level.
+    void computeInverseDiagonal(Level &l);
+    /**
+     * Builds the smoothed prolongator of given level and the corresponding restriction.
+     * @return Number of unknowns on the coarse level.
+     */
+    int buildTransfer(Level &l);
+    /// Applies one V-cycle starting at given level.
+    void vcycle(int level, const FloatArray &b, FloatArray &x) const;
+    /// Performs one forward (or backward) Gauss-Seidel sweep on given level.
+    void gaussSeidel(const Level &l, const FloatArray &b, FloatArray &x, bool backward) const;
+};
+} // end namespace oofem
+#endif // amgprecond_h
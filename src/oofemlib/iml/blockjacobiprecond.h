@@ -0,0 +1,94 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef blockjacobiprecond_h
+#define blockjacobiprecond_h
+
+#include "floatarray.h"
+#include "intarray.h"
+#include "precond.h"
+
+#include <vector>
+
+///@name Input fields for BlockJacobiPreconditioner
+//@{
+#define _IFT_BlockJacobiPreconditioner_nblocks "bjblocks"
+//@}
+
+namespace oofem {
+/**
+ * Block-Jacobi preconditioner with ILU(0) factorization of the diagonal blocks.
+ * The equations are split into contiguous ranges, couplings between the ranges are dropped and
+ * each diagonal block is factorized and solved independently, so that both the setup and the
+ * application run in parallel (one block per thread by default).
+ * Works with any storage supported by Preconditioner::giveCompressedRows.
+ */
+class OOFEM_EXPORT BlockJacobiPreconditioner : public Preconditioner
+{
+private:
+    /// Requested number of blocks (0 = number of threads).
+    int nblocks;
+    /// Block boundaries (size number of blocks + 1).
+    IntArray blockStart;
+    /// Row pointers of the block diagonal factors (L and U stored together, unit diagonal of L not stored).
+    IntArray rowptr;
+    /// Column indices of the factors.
+    IntArray colind;
+    /// Positions of the diagonal entries in each row.
+    IntArray diagptr;
+    /// Factor values.
+    FloatArray val;
+
+public:
+    /// Constructor. Initializes the the receiver (constructs the precontioning matrix M) of given matrix.
+    BlockJacobiPreconditioner(const SparseMtrx & A, InputRecord & attributes);
+    /// Constructor. The user should call initializeFrom and init services in this given order to ensure consistency.
+    BlockJacobiPreconditioner() : Preconditioner(), nblocks(0) { }
+    /// Destructor.
+    virtual ~BlockJacobiPreconditioner(void) { }
+
+    void init(const SparseMtrx &a) override;
+
+    void solve(const FloatArray &rhs, FloatArray &solution) const override;
+    void trans_solve(const FloatArray &rhs, FloatArray &solution) const override;
+
+    const char *giveClassName() const override { return "BJ-ILU"; }
+    void initializeFrom(InputRecord &ir) override;
+
+protected:
+    /// Computes ILU(0) factorization of given block in place, returns false on zero pivot.
+    bool factorizeBlock(int b, std :: vector< int > &work);
+};
+} // end namespace oofem
+#endif // blockjacobiprecond_h
@@ -37,6 +37,7 @@
 
 #include "oofemcfg.h"
 #include "floatarray.h"
+#include "intarray.h"
 #include "sparsemtrx.h"
 #include "inputrecord.h"
 
@@ -113,6 +114,18 @@ public:
     virtual const char *giveClassName() const { return "Preconditioner"; }
     /// Initializes receiver from given record. Empty implementation.
     virtual void initializeFrom(InputRecord &ir) { }
+
+protected:
+    /**
+     * Extracts the full compressed row (CSR, 0-based) representation of given matrix.
+     * Both triangles are returned for symmetric storages, column indices in each row are sorted.
+     * Supported are CompCol, SymCompCol and DynCompRow storages.
+     * @param a Source matrix.
+     * @param rowptr Row pointers (size n+1).
+     * @param colind Column indices.
+     * @param val Values.
+     */
+    static void giveCompressedRows(const SparseMtrx &a, IntArray &rowptr, IntArray &colind, FloatArray &val);
 };
 } // end namespace oofem
 #endif // precond_h
@@ -40,6 +40,8 @@
 #include "contextioresulttype.h"
 #include "contextmode.h"
 
+#include <cstddef>
+
 namespace oofem {
 class GaussPoint;
 class TimeStep;
@@ -54,6 +56,10 @@ class DataStream;
  *
  * Any object that stores its status in integration point is responsible for its creation,
  * initialization, and serialization.
+ *
+ * When configured with USE_IPSTATUS_POOL, the statuses are allocated from memory pools (one for each object size)
+ * instead of individual heap allocations. Statuses created one after another (typically those of the integration points
+ * of an element set sharing the same material) are then stored next to each other.
  */
 class OOFEM_EXPORT IntegrationPointStatus
 {
@@ -104,6 +110,13 @@ public:
     virtual Interface *giveInterface(InterfaceType t) { return nullptr; }
 
     virtual const char *giveClassName() const = 0; //{ return "IntegrationPointStatus"; }
+
+#ifdef __IPSTATUS_POOL
+    /// Allocates the status from the pool of given object size.
+    static void *operator new(std::size_t size);
+    /// Returns the status memory to its pool.
+    static void operator delete(void *ptr, std::size_t size);
+#endif
 };
 } // end namespace oofem
 #endif // integrationpointstatus_h
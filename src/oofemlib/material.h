@@ -185,6 +185,27 @@ public:
      */
     virtual bool hasCastingTimeSupport() const;
 
+    /**
+     * Tests if the material can be evaluated concurrently in different integration points,
+     * i.e. all state modified by the evaluation is stored in the material statuses.
+     * Materials keeping mutable state in the receiver (caches, counters, interpreter calls) must return false,
+     * the element loops of domains containing such a material are then evaluated by a single thread.
+     * @return True if material can be evaluated concurrently, false otherwise.
+     */
+    virtual bool supportsConcurrentEvaluation() const { return true; }
+    /**
+     * Evaluates in advance the response of all integration points of given domain which belong to the receiver.
+     * Intended for materials with independent but expensive points, which can not be evaluated concurrently
+     * from the element loop (such as multiscale models solving a subscale problem in every point).
+     * The points are then evaluated concurrently ahead of the element loop, and the results kept in the statuses
+     * are reused when requested by the elements. Invoked by the engineering model before assembling the internal forces
+     * and the tangent stiffness. Default implementation does nothing.
+     * @param d Domain.
+     * @param tStep Solution step.
+     * @param tangent Determines whether the tangent stiffness (true) or the stress (false) is to be evaluated.
+     */
+    virtual void updateDomainResponse(Domain *d, TimeStep *tStep, bool tangent) { }
+
     ///@name Access functions for internal states. Usually overloaded by new material models.
     //@{
     /**
@@ -42,6 +42,8 @@
 #include "internalstatetype.h"
 #include "set.h"
 
+#include <vector>
+
 namespace oofem {
 class Domain;
 class Element;
@@ -138,6 +140,20 @@ public:
      * @return Nonzero if o.k.
      */
     virtual int __mapVariable(FloatArray &answer, const FloatArray &coords, InternalStateType type, TimeStep *tStep) = 0;
+    /**
+     * Maps the unknown of given type from old mesh to a set of points.
+     * The default implementation initializes the receiver and maps the variable point by point,
+     * the mappers based on spatial localization locate all points by single batched query.
+     * @param answer Contains results, the value is empty for points, where mapping failed.
+     * @param dold Old domain.
+     * @param coords Coordinates of receiver points.
+     * @param sourceElemSet Only source elements within given set are considered.
+     * @param type Determines the type of internal variable.
+     * @param tStep Time step.
+     * @return Number of successfully mapped points.
+     */
+    virtual int mapVariables(std :: vector< FloatArray > &answer, Domain *dold, const std :: vector< FloatArray > &coords,
+                             Set &sourceElemSet, InternalStateType type, TimeStep *tStep);
     /**
      * Initializes receiver according to object description stored in input record.
      * InitString can be imagined as data record in component database
@@ -65,6 +65,9 @@ public:
 
     int __mapVariable(FloatArray &answer, const FloatArray &coords, InternalStateType type, TimeStep *tStep) override;
 
+    int mapVariables(std :: vector< FloatArray > &answer, Domain *dold, const std :: vector< FloatArray > &coords,
+                     Set &sourceElemSet, InternalStateType type, TimeStep *tStep) override;
+
     int mapStatus(MaterialStatus &oStatus) const override;
 
     const char *giveClassName() const override { return "MMAClosestIPTransfer"; }
@@ -62,9 +62,16 @@ public:
 
     int __mapVariable(FloatArray &answer, const FloatArray &coords, InternalStateType type, TimeStep *tStep) override;
 
+    int mapVariables(std :: vector< FloatArray > &answer, Domain *dold, const std :: vector< FloatArray > &coords,
+                     Set &sourceElemSet, InternalStateType type, TimeStep *tStep) override;
+
     int mapStatus(MaterialStatus &oStatus) const override;
 
     const char *giveClassName() const override { return "MMAContainingElementProjection"; }
+
+protected:
+    /// Returns the integration point of given element closest to given point.
+    static GaussPoint *giveClosestIPInElement(Element *elem, const FloatArray &coords);
 };
 } // end namespace oofem
 #endif // mmacontainingelementprojection_h
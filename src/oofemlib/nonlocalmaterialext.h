@@ -38,12 +38,15 @@
 #include "matstatus.h"
 #include "interface.h"
 #include "intarray.h"
+#include "floatarray.h"
 #include "grid.h"
 #include "mathfem.h"
 #include "dynamicinputrecord.h"
+#include "statecountertype.h"
 
 #include <list>
 #include <memory>
+#include <vector>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -68,6 +71,7 @@
 #define _IFT_NonlocalMaterialExtensionInterface_initdiag "initdiag"
 #define _IFT_NonlocalMaterialExtensionInterface_order "order"
 #define _IFT_NonlocalMaterialExtensionInterface_centdiff "centdiff"
+#define _IFT_NonlocalMaterialExtensionInterface_interactiontable "nltable"
 //@}
 
 namespace oofem {
@@ -93,6 +97,88 @@ struct localIntegrationRecord {
                            WFT_UniformOverElement,
                            WFT_Green_21 }; 
 
+/**
+ * Compressed storage of the nonlocal interactions of all integration points in the domain.
+ * Integration points of the default integration rules are numbered consecutively element by element,
+ * row i holds the indices of the points influencing point i together with their (unscaled) weights,
+ * stored in compressed row format. Compared to the lists kept in individual statuses, one interaction
+ * takes one integer and one double and the rows are stored contiguously, so that the whole nonlocal
+ * average can be evaluated as a single sparse matrix-vector product.
+ */
+class OOFEM_EXPORT NonlocalInteractionTable
+{
+public:
+    /// Index of the first point of each element (0-based), size is number of elements + 1.
+    IntArray elemOffset;
+    /// Integration points in table numbering.
+    std :: vector< GaussPoint * >points;
+    /// Row pointers (0-based), size is number of points + 1.
+    IntArray rowptr;
+    /// Indices of interacting points.
+    IntArray colind;
+    /// Interaction weights (weight function times volume of the source point).
+    FloatArray weight;
+    /// Indices of points, which act as sources for some row (sorted).
+    IntArray sources;
+    /// Sum of the weights of each row.
+    FloatArray scale;
+    /// Volume around each point.
+    FloatArray volume;
+
+    /// Returns the number of points in table.
+    int giveNumberOfPoints() const { return ( int ) points.size(); }
+    /// Returns the number of stored interactions.
+    int giveNumberOfInteractions() const { return rowptr.isEmpty() ? 0 : rowptr[ rowptr.giveSize() - 1 ]; }
+    /// Returns the table index of given integration point or -1 if the point is not in the table.
+    int giveIndex(GaussPoint *gp) const;
+    /**
+     * Evaluates answer_i = sum_j w_ij x_j for all points (the weights are not rescaled).
+     * @param x Averaged quantity in table numbering.
+     * @param answer Weighted sums.
+     */
+    void average(const FloatArray &x, FloatArray &answer) const;
+};
+
+/**
+ * Lightweight view of the nonlocal interactions of a single integration point. Iterates either over the row
+ * of NonlocalInteractionTable or over the list stored in the status, yielding localIntegrationRecord values.
+ */
+class OOFEM_EXPORT NonlocalInteractionRange
+{
+protected:
+    const NonlocalInteractionTable *table;
+    const localIntegrationRecord *list;
+    int first, last;
+
+public:
+    class iterator
+    {
+        const NonlocalInteractionRange *range;
+        int pos;
+public:
+        iterator(const NonlocalInteractionRange *r, int p) : range(r), pos(p) { }
+        localIntegrationRecord operator*() const {
+            if ( range->table ) {
+                return {range->table->points [ range->table->colind [ pos ] ], range->table->weight [ pos ]};
+            }
+            return range->list [ pos ];
+        }
+        iterator &operator++() { ++pos; return * this; }
+        bool operator!=(const iterator &other) const { return pos != other.pos; }
+    };
+
+    /// Creates a view of row of interaction table.
+    NonlocalInteractionRange(const NonlocalInteractionTable *t, int row) :
+        table(t), list(nullptr), first(t->rowptr [ row ]), last(t->rowptr [ row + 1 ]) { }
+    /// Creates a view of integration list.
+    NonlocalInteractionRange(const std :: vector< localIntegrationRecord > &l) :
+        table(nullptr), list(l.data()), first(0), last( ( int ) l.size() ) { }
+
+    iterator begin() const { return iterator(this, first); }
+    iterator end() const { return iterator(this, last); }
+    int giveSize() const { return last - first; }
+};
+
 /**
  * Abstract base class for all nonlocal constitutive model statuses. Introduces the list of
  * localIntegrationRecords stored in each integration point, where references to all influencing
@@ -187,6 +273,16 @@ protected:
     IntArray regionMap;
     /// Flag indicating whether to keep nonlocal interaction tables of integration points cached.
     bool permanentNonlocTableFlag = false;
+    /// Flag indicating whether the interactions are stored in compressed table instead of per-point lists.
+    bool useInteractionTable = false;
+    /// Compressed interaction table (built on first request when useInteractionTable is set).
+    mutable std :: unique_ptr< NonlocalInteractionTable >interactionTable;
+    /// Weighted sums of averaged variable computed by averaging sweep (in table numbering).
+    mutable FloatArray nonlocalSums;
+    /// Solution state counter of nonlocalSums.
+    mutable StateCounterType nonlocalSumsStateCounter = 0;
+    /// Flag indicating that nonlocalSums have been evaluated.
+    mutable bool nonlocalSumsValid = false;
     /// Parameter specifying the type of nonlocal weight function.
     WeightFunctionType weightFun;
     /// Grid on which the eikonal equation will be solved (used by eikonal nonlocal models)
@@ -265,6 +361,7 @@ protected:
 #ifdef _OPENMP
  public:
     static omp_lock_t updateDomainBeforeNonlocAverageLock;
+    static omp_lock_t interactionTableLock;
 #endif
 public:
     /**
@@ -293,6 +390,38 @@ public:
      */
     void updateDomainBeforeNonlocAverage(TimeStep *tStep) const;
 
+    /**
+     * Updates the nonlocal state of all materials in the domain in two phases. First, local variables
+     * are updated in all elements (see Element::updateBeforeNonlocalAverage), then the materials evaluate
+     * their nonlocal averages (see computeNonlocalAverages). Both sweeps are threaded when invoked
+     * outside of parallel region. Engineering models call this before the (parallel) evaluation of
+     * internal forces, so that the averaging needs not to be triggered lazily under a lock from
+     * individual integration points. Does nothing if the domain contains no nonlocal materials or
+     * the update has already been done for the current solution state.
+     * @param d Domain to update.
+     * @param tStep Solution step.
+     */
+    static void updateDomainNonlocalState(Domain *d, TimeStep *tStep);
+    /**
+     * Evaluates the weighted sums of the averaged variable for all points of the receiver at once,
+     * using the interaction table. Done only if interaction table is used and the model supports
+     * averaging sweep (see supportsAveragingSweep). Called by updateDomainNonlocalState.
+     */
+    void computeNonlocalAverages(TimeStep *tStep) const;
+    /**
+     * Returns the weighted sum of the averaged variable around given point, if evaluated by the averaging sweep.
+     * The sum is not rescaled.
+     * @param answer Weighted sum.
+     * @param gp Integration point.
+     * @param tStep Solution step.
+     * @return True if the sum is available, false if it has to be evaluated by the model itself.
+     */
+    bool giveNonlocalSum(double &answer, GaussPoint *gp, TimeStep *tStep) const;
+    /// Returns true if the model averages a single variable given by giveLocalVariableForAverage with fixed weights.
+    virtual bool supportsAveragingSweep() const { return false; }
+    /// Returns the local value of averaged variable in given point (see supportsAveragingSweep).
+    virtual double giveLocalVariableForAverage(GaussPoint *gp) const { return 0.; }
+
     /**
      * Builds list of integration points which take part in nonlocal average in given integration point.
      * This list is stored in integration point corresponding nonlocal status.
@@ -312,6 +441,14 @@ public:
      */
     void rebuildNonlocalPointTable(GaussPoint *gp, IntArray *contributingElems) const;
 
+    /**
+     * Returns the compressed interaction table of the whole domain, building it on first request.
+     * Returns NULL if the per-point integration lists are used instead (default).
+     */
+    const NonlocalInteractionTable *giveInteractionTable() const;
+    /// Invalidates the interaction table, it will be rebuilt on next request.
+    void clearInteractionTable() const { interactionTable.reset(); nonlocalSumsValid = false; }
+
     /**
      * Recompute the nonlocal interaction weights based on the current solution (e.g., on the damage field).
      * This method is used e.g. by eikonal nonlocal damage models.
@@ -346,6 +483,12 @@ public:
      * Rebuilds the IP list by calling  buildNonlocalPointTable if not available.
      */
     std :: vector< localIntegrationRecord > *giveIPIntegrationList(GaussPoint *gp) const;
+    /**
+     * Returns the interactions of given integration point. Reads the row of interaction table if used,
+     * otherwise the IP integration list (see giveIPIntegrationList). Preferred by averaging loops,
+     * since it avoids the construction of per-point lists.
+     */
+    NonlocalInteractionRange giveIPInteractions(GaussPoint *gp) const;
 
     /**
      * Evaluates the basic nonlocal weight function for a given distance
@@ -455,6 +598,16 @@ protected:
      */
     double giveDistanceBasedInteractionRadius(const FloatArray &gpCoords) const;
 
+    /**
+     * Computes the interactions of given integration point with all points within support of weight function.
+     * @param gp Receiver point.
+     * @param list Interactions are appended to this list.
+     * @return Integration volume (sum of the weights).
+     */
+    double computeNonlocalInteractions(GaussPoint *gp, std :: vector< localIntegrationRecord > &list) const;
+    /// Builds the compressed interaction table of the whole domain.
+    void buildInteractionTable() const;
+
     int mapToGridPoint(double x, double x0) const { return 1 + gridSize + ( int ) ceil(gridSize * ( x - x0 ) / suprad - 0.5); }
     double mapToGridCoord(double x, double x0) const { return 1. + gridSize + gridSize * ( x - x0 ) / suprad; }
     double dist2FromGridNode(double x, double y, int j, int i) const { return ( ( x - j ) * ( x - j ) + ( y - i ) * ( y - i ) ); }
@@ -39,6 +39,9 @@
 #include "oofemtxtinputrecord.h"
 
 #include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace oofem {
 /**
@@ -48,15 +51,16 @@ namespace oofem {
  * There is no check for record type requested, it is assumed that records are
  * written in correct order, which determined by the coded sequence of
  * component initialization and described in input manual.
+ * The input file is memory mapped and split into lines; the records are then tokenized in parallel.
  */
 class OOFEM_EXPORT OOFEMTXTDataReader : public DataReader
 {
 protected:
     std :: string dataSourceName;
-    std :: list< OOFEMTXTInputRecord > recordList;
+    std :: vector< OOFEMTXTInputRecord > recordList;
 
     /// Keeps track of the current position in the list
-    std :: list< OOFEMTXTInputRecord > :: iterator it;
+    std :: vector< OOFEMTXTInputRecord > :: iterator it;
 
 public:
     /// Constructor.
@@ -71,12 +75,23 @@ public:
 
 protected:
     /**
-     * Reads one line from inputStream
+     * Reads all lines of given file, appending them together with their line numbers to answer.
+     * @param filename Name of the file.
+     * @param answer Lines read.
+     * @param header Determines whether the header lines (output file name and description) are read first.
+     */
+    void readLinesFromFile(const std :: string &filename, std :: vector< std :: pair< int, std :: string > > &answer, bool header);
+    /**
+     * Reads one line from input buffer.
      * Parts within quotations have case preserved.
+     * @param pos Current position in buffer, updated on return.
+     * @param end End of buffer.
+     * @param lineNum Line number, updated on return.
+     * @param line Line read.
      */
-    bool giveLineFromInput(std :: ifstream &stream, int &lineNum, std :: string &line);
-    /// Reads one line from stream.
-    bool giveRawLineFromInput(std :: ifstream &stream, int &lineNum, std :: string &line);
+    bool giveLineFromInput(const char * &pos, const char *end, int &lineNum, std :: string &line);
+    /// Reads one line from input buffer.
+    bool giveRawLineFromInput(const char * &pos, const char *end, int &lineNum, std :: string &line);
 };
 } // end namespace oofem
 #endif // oofemtxtdatareader_h
@@ -40,6 +40,8 @@
 
 #include <string>
 #include <vector>
+#include <memory>
+#include <unordered_map>
 
 namespace oofem {
 /**
@@ -56,6 +58,11 @@ protected:
      */
     Tokenizer tokenizer;
     std :: vector< bool >readFlag;
+    /**
+     * Index of the first occurrence of each token, built on first keyword lookup in long records.
+     * Short records (nodes, elements) are searched linearly, which is faster for few tokens.
+     */
+    std :: unique_ptr< std :: unordered_map< std :: string, int > >keywordIndex;
 
     /// Record representation.
     std :: string record;
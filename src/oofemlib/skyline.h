@@ -103,6 +103,7 @@ public:
 
     int assemble(const IntArray &loc, const FloatMatrix &mat) override;
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
+    bool supportsConcurrentAssembly() const override { return true; }
 
     bool canBeFactorized() const override { return true; }
     SparseMtrx *factorized() override;
@@ -236,6 +236,13 @@ public:
     virtual int assembleBegin() { return 1; }
     /// Returns when assemble is completed.
     virtual int assembleEnd() { return 1; }
+    /**
+     * Determines whether assemble may be called from several threads at once, provided that the concurrently
+     * assembled contributions do not share any row or column (see EngngModel::assemble).
+     * This requires that assembling only touches the addressed entries, and that the sparsity structure is not
+     * shared between rows or columns.
+     */
+    virtual bool supportsConcurrentAssembly() const { return false; }
 
     /// Determines, whether receiver can be factorized.
     virtual bool canBeFactorized() const = 0;
@@ -43,6 +43,8 @@
 
 #include <set>
 #include <list>
+#include <vector>
+#include <functional>
 
 namespace oofem {
 class Domain;
@@ -176,6 +178,41 @@ public:
      */
     virtual GaussPoint *giveClosestIP(const FloatArray &coords, Set &elemSet, bool iCohesiveZoneGP = false) = 0;
 
+    /**
+     * Batched variant of giveElementContainingPoint, which also evaluates the local coordinates of points.
+     * The points are processed in spatially sorted order; each query is first tested against the element
+     * found for the previous point, only then the localizer is searched. Blocks of sorted points are processed in parallel.
+     * @param answer Numbers of elements containing given points (zero if not found).
+     * @param lcoords Local coordinates of points within found elements.
+     * @param coords Global coordinates of points.
+     * @param regionList Only elements within given regions are considered, if NULL all regions are considered.
+     */
+    virtual void giveElementsContainingPoints(IntArray &answer, std :: vector< FloatArray > &lcoords,
+                                              const std :: vector< FloatArray > &coords, const IntArray *regionList = nullptr);
+    /**
+     * Batched variant of giveElementContainingPoint, which also evaluates the local coordinates of points.
+     * @param answer Numbers of elements containing given points (zero if not found).
+     * @param lcoords Local coordinates of points within found elements.
+     * @param coords Global coordinates of points.
+     * @param eset Only elements within given set are considered.
+     */
+    virtual void giveElementsContainingPoints(IntArray &answer, std :: vector< FloatArray > &lcoords,
+                                              const std :: vector< FloatArray > &coords, const Set &eset);
+    /**
+     * Batched variant of giveClosestIP. The points are processed in spatially sorted order, in parallel.
+     * @param answer Closest integration points (NULL if not found).
+     * @param coords Global coordinates of points.
+     * @param elemSet Only points of elements within given set are considered.
+     */
+    virtual void giveClosestIPs(std :: vector< GaussPoint * > &answer, const std :: vector< FloatArray > &coords,
+                                Set &elemSet, bool iCohesiveZoneGP = false);
+    /**
+     * Sorts the points along the space filling (Morton) curve, so that the subsequent points are close to each other.
+     * @param order Indices of points in sorted order.
+     * @param coords Coordinates of points.
+     */
+    static void giveSpatialOrder(std :: vector< int > &order, const std :: vector< FloatArray > &coords);
+
     /**
      * Returns container (set) of all domain elements having integration point within given box.
      * @param elemSet Answer containing the list of elements meeting the criteria.
@@ -227,6 +264,14 @@ public:
     virtual const char *giveClassName() const = 0;
     /// Error printing helper.
     std :: string errorInfo(const char *func) const { return std :: string(giveClassName()) + func; }
+
+protected:
+    /**
+     * Implementation of batched point location, warm-started from previous hit.
+     * @param locate Function returning the element containing given point.
+     */
+    void locatePoints(IntArray &answer, std :: vector< FloatArray > &lcoords, const std :: vector< FloatArray > &coords,
+                      const std :: function< Element *(const FloatArray &) > &locate);
 };
 } // end namespace oofem
 #endif // spatiallocalizer_h
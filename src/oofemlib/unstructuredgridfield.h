@@ -337,22 +337,12 @@ public:
 
     int evaluateAt(FloatArray &answer, const FloatArray &coords,
                    ValueModeType mode, TimeStep *tStep) override {
-        std::list< Cell >elist;
         if ( ( mode == VM_Total ) || ( mode == VM_TotalIntrinsic ) ) {
             if ( this->cellList.size() > 0 ) {
                 this->initOctree();
-                CellContainingPointFunctor f(coords);
-                this->spatialLocalizer.giveDataOnFilter(elist, f);
-                if ( elist.size() ) {
-                    Cell &c = elist.front(); // take first
-                    // colect vertex values
-                    int size = c.giveNumberOfVertices();
-                    FloatArray **vertexValues = new FloatArray * [ size ];
-                    for ( int i = 0; i < size; i++ ) {
-                        vertexValues [ i ] = & ( this->valueList [ c.getVertexNum(i + 1) - 1 ] );
-                    }
-                    c.interpolate(answer, coords, vertexValues);
-                    //answer.printYourself();
+                Cell c;
+                if ( this->giveCellContainingPoint(c, coords) ) {
+                    this->interpolateInCell(answer, c, coords);
                     return 0;
                 } else {
                     coords.printYourself();
@@ -360,31 +350,52 @@ public:
                     return 1;
                 }
             } else {
-                if ( !this->vertexList.size() ) {
-                    OOFEM_ERROR("No vertices defined");
-                    return 1;
-                }
-                // alternative method - we use the value of the closest point
-                double minDist = 0., dist = 0.;
-
-                int idOfClosestPoint = -1;
-                for ( int i = 0; i < ( int ) this->vertexList.size(); i++ ) {
-                    const auto &pcoords = this->vertexList [ i ].getCoordinates();
-                    dist = sqrt(pow(coords [ 0 ] - pcoords.at(1), 2) + pow(coords [ 1 ] - pcoords.at(2), 2) + pow(coords [ 2 ] - pcoords.at(3), 2) );
-                    if ( ( dist < minDist ) || ( !i ) ) {
-                        minDist = dist;
-                        idOfClosestPoint = i;
-                    }
-                }
-                answer = this->valueList [ idOfClosestPoint ];
-                //printf("closest point is %d\n",idOfClosestPoint);
-                return 0;
+                return this->giveClosestVertexValue(answer, coords);
             }
         } else {
             OOFEM_ERROR("Unsupported ValueModeType");
         }
     }
 
+    /**
+     * Evaluates the field at a set of points. The points are processed in spatially sorted order
+     * and each point is first tested against the cell containing the previous one, before the octree is searched.
+     * @param answer Field values at given points.
+     * @param coords Coordinates of points.
+     * @param mode Mode of value.
+     * @param tStep Time step.
+     */
+    void evaluateAt(std::vector< FloatArray > &answer, const std::vector< FloatArray > &coords,
+                    ValueModeType mode, TimeStep *tStep) {
+        if ( ( mode != VM_Total ) && ( mode != VM_TotalIntrinsic ) ) {
+            OOFEM_ERROR("Unsupported ValueModeType");
+        }
+        answer.resize( coords.size() );
+        if ( this->cellList.size() == 0 ) {
+            for ( size_t i = 0; i < coords.size(); i++ ) {
+                this->giveClosestVertexValue(answer [ i ], coords [ i ]);
+            }
+            return;
+        }
+
+        this->initOctree();
+        std::vector< int >order;
+        SpatialLocalizer::giveSpatialOrder(order, coords);
+        Cell c;
+        bool found = false;
+        for ( int i : order ) {
+            // warm start: the cell containing previous point is tested first
+            if ( !( found && c.containsPoint(coords [ i ]) ) ) {
+                found = this->giveCellContainingPoint(c, coords [ i ]);
+                if ( !found ) {
+                    coords [ i ].printYourself();
+                    OOFEM_ERROR("No cells defined");
+                }
+            }
+            this->interpolateInCell(answer [ i ], c, coords [ i ]);
+        }
+    }
+
     /**
      * Implementaton of Field::evaluateAt for DofManager.
      */
@@ -401,6 +412,52 @@ public:
     const char *giveClassName() const override { return "UnstructuredGridField"; }
 
 protected:
+    /// Finds the cell containing given point, returns false if not found.
+    bool giveCellContainingPoint(Cell &answer, const FloatArray &coords) {
+        std::list< Cell >elist;
+        CellContainingPointFunctor f(coords);
+        this->spatialLocalizer.giveDataOnFilter(elist, f);
+        if ( elist.size() ) {
+            answer = elist.front(); // take first
+            return true;
+        }
+        return false;
+    }
+
+    /// Interpolates vertex values of given cell at given point.
+    void interpolateInCell(FloatArray &answer, Cell &c, const FloatArray &coords) {
+        // colect vertex values
+        int size = c.giveNumberOfVertices();
+        std::vector< FloatArray * >vertexValues(size);
+        for ( int i = 0; i < size; i++ ) {
+            vertexValues [ i ] = & ( this->valueList [ c.getVertexNum(i + 1) - 1 ] );
+        }
+        c.interpolate(answer, coords, vertexValues.data() );
+    }
+
+    /// Gives the value of the vertex closest to given point (used if there are no cells).
+    int giveClosestVertexValue(FloatArray &answer, const FloatArray &coords) {
+        if ( !this->vertexList.size() ) {
+            OOFEM_ERROR("No vertices defined");
+            return 1;
+        }
+        // alternative method - we use the value of the closest point
+        double minDist = 0., dist = 0.;
+
+        int idOfClosestPoint = -1;
+        for ( int i = 0; i < ( int ) this->vertexList.size(); i++ ) {
+            const auto &pcoords = this->vertexList [ i ].getCoordinates();
+            dist = sqrt(pow(coords [ 0 ] - pcoords.at(1), 2) + pow(coords [ 1 ] - pcoords.at(2), 2) + pow(coords [ 2 ] - pcoords.at(3), 2) );
+            if ( ( dist < minDist ) || ( !i ) ) {
+                minDist = dist;
+                idOfClosestPoint = i;
+            }
+        }
+        answer = this->valueList [ idOfClosestPoint ];
+        //printf("closest point is %d\n",idOfClosestPoint);
+        return 0;
+    }
+
     void initOctree() {
         if ( this->timeStamp != this->octreeTimeStamp ) {
             // rebuild octree
@@ -94,9 +94,6 @@ protected:
     /// Returns the filename for the given time step.
     std::string giveOutputFileName(TimeStep *tStep);
 
-    /// Returns the output stream for given solution step.
-    std::ofstream giveOutputStream(TimeStep *tStep);
-
     bool writeXFEMVars(VTKPiece &vtkPiece, int field, int enrItIndex);
     void getNodalVariableFromXFEMST(FloatArray &answer, Node *node, TimeStep *tStep, XFEMStateType xfemstype, Set &region, EnrichmentItem *ei);
     void exportIntVars(VTKPiece &vtkPiece, Set& region, int field, int enrItIndex,  IntArray& internalVarsToExport, NodalRecoveryModel& smoother, TimeStep *tStep);
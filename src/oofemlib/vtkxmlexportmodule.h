@@ -67,6 +67,11 @@ namespace py = pybind11;
 
 #include <string>
 #include <list>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <sstream>
+#include <type_traits>
 
 ///@name Input fields for VTK XML export module
 //@{
@@ -77,11 +82,15 @@ namespace py = pybind11;
 #define _IFT_VTKXMLExportModule_externalForces "externalforces"
 #define _IFT_VTKXMLExportModule_ipvars "ipvars"
 #define _IFT_VTKXMLExportModule_stype "stype"
+#define _IFT_VTKXMLExportModule_dataformat "dataformat"
+#define _IFT_VTKXMLExportModule_compress "compress"
+#define _IFT_VTKXMLExportModule_async "async"
 //@}
 
 using namespace std;
 namespace oofem {
 class Node;
+class AsyncFileWriter;
 
 /**
  * Represents VTK (Visualization Toolkit) export module. It uses VTK (.vtu) file format, Unstructured grid dataset.
@@ -92,6 +101,14 @@ class Node;
  */
 class OOFEM_EXPORT VTKXMLExportModule : public VTKBaseExportModule
 {
+public:
+    /// Format of the data arrays in the exported vtu files.
+    enum DataFormat {
+        DF_ASCII = 0,    ///< Human readable ascii data (default).
+        DF_Binary = 1,   ///< Base64 encoded binary data, inlined in each DataArray.
+        DF_Appended = 2, ///< Raw binary data appended at the end of the file.
+    };
+
 protected:
     /// List of InternalStateType values, identifying the selected vars for export.
     IntArray internalVarsToExport;
@@ -119,6 +136,15 @@ protected:
     /// Buffer for earlier time steps with gauss points exported to *.gp.pvd file.
     std::list< std::string >gpPvdBuffer;
 
+    /// Format of the data arrays.
+    DataFormat dataFormat;
+    /// Determines whether binary data arrays are compressed (zlib).
+    bool compress;
+    /// Determines whether the vtu files are written by a background thread.
+    bool asyncOutput;
+    /// Writer of the vtu files in asynchronous mode (created on first use).
+    std::unique_ptr< AsyncFileWriter >fileWriter;
+
 
 public:
     /// Constructor. Creates empty Output Manager. By default all components are selected.
@@ -150,7 +176,8 @@ public:
     vtkSmartPointer< vtkDoubleArray >intVarArray;
     vtkSmartPointer< vtkDoubleArray >primVarArray;
 #else
-    std::ofstream fileStream;
+    /// Text of the exported vtu file written since the last data array.
+    std::ostringstream fileStream;
 #endif
 
     VTKPiece defaultVTKPiece;
@@ -163,9 +190,6 @@ protected:
     /// Returns the filename for the given time step.
     std::string giveOutputFileName(TimeStep *tStep);
 
-    /// Returns the output stream for given solution step.
-    std::ofstream giveOutputStream(TimeStep *tStep);
-
     void writeIntVars(VTKPiece &vtkPiece);
     void writeXFEMVars(VTKPiece &vtkPiece);
     void writePrimaryVars(VTKPiece &vtkPiece);
@@ -202,14 +226,81 @@ protected:
 
 #ifdef __VTK_MODULE
     void writeVTKPointData(const char *name, vtkSmartPointer< vtkDoubleArray >varArray);
-#else
-    void writeVTKPointData(FloatArray &valueArray);
-#endif
-
-#ifdef __VTK_MODULE
     void writeVTKCellData(const char *name, vtkSmartPointer< vtkDoubleArray >varArray);
 #else
-    void writeVTKCellData(FloatArray &valueArray);
+    /**
+     * Part of an exported vtu file; the text followed by the writer of one data array.
+     * The data arrays are formatted (and compressed) only when the file is written, possibly in the background.
+     */
+    struct DocumentPart {
+        std::string text;
+        /// Writes the data array to the stream; the data in appended format are collected in the given buffer.
+        std::function< void(std::ostream &, std::string &) >writeDataArray;
+    };
+    /// Parts of the exported vtu file, which are completed by the text in fileStream.
+    std::vector< DocumentPart >documentParts;
+
+    /**
+     * Starts a new vtu file and writes the header (opening VTKFile and UnstructuredGrid tags) declaring the selected data format.
+     */
+    void writeVTKFileHeader(TimeStep *tStep);
+    /**
+     * Closes the UnstructuredGrid and writes the vtu file, including the appended data section (if any).
+     * In asynchronous mode the file is written by a background thread.
+     * @param fileName Name of the output file.
+     */
+    void writeVTKFileFooter(const std::string &fileName);
+    /**
+     * Writes a DataArray element in the selected data format.
+     * The values are taken over and formatted when the file is written.
+     * @param type VTK type name of the values (e.g. Float64, Int32, UInt8).
+     * @param name Name of the array, omitted if empty.
+     * @param ncomponents Number of components, omitted if zero.
+     * @param data Values to write.
+     */
+    template< typename T >
+    void writeDataArray(const char *type, const std::string &name, int ncomponents, std::vector< T >data)
+    {
+        this->fileStream << " <DataArray type=\"" << type << "\"";
+        if ( !name.empty() ) {
+            this->fileStream << " Name=\"" << name << "\"";
+        }
+        if ( ncomponents > 0 ) {
+            this->fileStream << " NumberOfComponents=\"" << ncomponents << "\"";
+        }
+
+        DataFormat format = this->dataFormat;
+        bool compressed = this->compress;
+        this->documentParts.push_back({ this->fileStream.str(), [format, compressed, data = std::move(data)](std::ostream &stream, std::string &appendedData) {
+            if ( format == DF_ASCII ) {
+                stream << " format=\"ascii\"> ";
+                if ( std::is_floating_point< T >::value ) {
+                    stream << scientific;
+                }
+                for ( const auto &val : data ) {
+                    stream << +val << " ";
+                }
+                stream << "</DataArray>\n";
+            } else {
+                writeBinaryData(stream, appendedData, format, compressed, reinterpret_cast< const char * >( data.data() ), data.size() * sizeof( T ) );
+            }
+        } });
+        this->fileStream.str("");
+    }
+    /**
+     * Writes the format attribute and the (possibly compressed) binary data of a DataArray, including the closing of the element.
+     * Inlined data are base64 encoded, appended data are stored in the appendedData buffer.
+     */
+    static void writeBinaryData(std::ostream &stream, std::string &appendedData, DataFormat format, bool compressed, const char *bytes, std::size_t nbytes);
+    /// Writes the parts of a vtu file to the file with given name.
+    static void writeDocument(const std::string &fileName, bool binary, const std::vector< DocumentPart > &parts);
+    /// Appends the values of given array to data.
+    static void appendValues(std::vector< double > &data, const FloatArray &valueArray)
+    {
+        for ( double val : valueArray ) {
+            data.push_back(val);
+        }
+    }
 #endif
 
     // Export of composite elements (built up from several subcells)
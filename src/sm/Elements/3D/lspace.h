@@ -41,6 +41,9 @@
 #include "sprnodalrecoverymodel.h"
 #include "nodalaveragingrecoverymodel.h"
 #include "spatiallocalizer.h"
+#include "floatmatrixf.h"
+
+#include <utility>
 
 #define _IFT_LSpace_Name "lspace"
 #define _IFT_LSpace_reducedShearIntegration "reducedshearint"
@@ -114,6 +117,14 @@ protected:
     //@{
     int computeLoadLSToLRotationMatrix(FloatMatrix &answer, int iSurf, GaussPoint *gp) override;
     //@}
+    bool computeFixedSizeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep) override;
+    bool computeFixedSizeInternalForcesVector(FloatArray &answer, TimeStep *tStep) override;
+
+public:
+    /// Checks whether the fixed size kernels apply; derived elements modify the approximation and use the general implementation.
+    bool hasFixedSizeKernel();
+    /// Returns the Jacobian determinant and the fixed size geometric matrix at given integration point.
+    std :: pair< double, FloatMatrixF< 6, 24 > >computeFixedSizeBmatrixAt(GaussPoint *gp);
 };
 } // end namespace oofem
 #endif // lspace_h
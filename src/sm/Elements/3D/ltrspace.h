@@ -44,6 +44,9 @@
 #include "spatiallocalizer.h"
 #include "sm/ErrorEstimators/zzerrorestimator.h"
 #include "mmashapefunctprojection.h"
+#include "floatmatrixf.h"
+
+#include <utility>
 
 #define _IFT_LTRSpace_Name "ltrspace"
 
@@ -102,6 +105,15 @@ public:
                                                           IntArray &controlNode, IntArray &controlDof,
                                                           HuertaErrorEstimator :: AnalysisMode aMode) override;
     void HuertaErrorEstimatorI_computeNmatrixAt(GaussPoint *gp, FloatMatrix &answer) override;
+protected:
+    bool computeFixedSizeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep) override;
+    bool computeFixedSizeInternalForcesVector(FloatArray &answer, TimeStep *tStep) override;
+
+public:
+    /// Checks whether the fixed size kernels apply; derived elements modify the approximation and use the general implementation.
+    bool hasFixedSizeKernel();
+    /// Returns the Jacobian determinant and the fixed size geometric matrix at given integration point.
+    std :: pair< double, FloatMatrixF< 6, 12 > >computeFixedSizeBmatrixAt(GaussPoint *gp);
 };
 } // end namespace oofem
 #endif // ltrspace_h
@@ -41,6 +41,9 @@
 #include "nodalaveragingrecoverymodel.h"
 #include "sprnodalrecoverymodel.h"
 #include "spatiallocalizer.h"
+#include "floatmatrixf.h"
+
+#include <utility>
 
 #define _IFT_QSpace_Name "qspace"
 
@@ -91,6 +94,14 @@ protected:
     //@{
     int computeLoadLSToLRotationMatrix(FloatMatrix &answer, int, GaussPoint *gp) override;
     //@}
+    bool computeFixedSizeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep) override;
+    bool computeFixedSizeInternalForcesVector(FloatArray &answer, TimeStep *tStep) override;
+
+public:
+    /// Checks whether the fixed size kernels apply; derived elements modify the approximation and use the general implementation.
+    bool hasFixedSizeKernel();
+    /// Returns the Jacobian determinant and the fixed size geometric matrix at given integration point.
+    std :: pair< double, FloatMatrixF< 6, 60 > >computeFixedSizeBmatrixAt(GaussPoint *gp);
 };
 } // end namespace oofem
 #endif
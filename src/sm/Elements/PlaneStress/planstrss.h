@@ -41,6 +41,9 @@
 #include "zznodalrecoverymodel.h"
 #include "sprnodalrecoverymodel.h"
 #include "spatiallocalizer.h"
+#include "floatmatrixf.h"
+
+#include <utility>
 
 #define _IFT_PlaneStress2d_Name "planestress2d"
 
@@ -101,6 +104,14 @@ protected:
     void computeBHmatrixAt(GaussPoint *gp, FloatMatrix &answer) override;
 
     int giveNumberOfIPForMassMtrxIntegration() override { return 4; } 
+    bool computeFixedSizeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep) override;
+    bool computeFixedSizeInternalForcesVector(FloatArray &answer, TimeStep *tStep) override;
+
+public:
+    /// Checks whether the fixed size kernels apply; derived elements modify the approximation and use the general implementation.
+    bool hasFixedSizeKernel();
+    /// Returns the Jacobian determinant and the fixed size geometric matrix at given integration point.
+    std :: pair< double, FloatMatrixF< 3, 8 > >computeFixedSizeBmatrixAt(GaussPoint *gp);
 };
 } // end namespace oofem
 #endif // planstrss_h
@@ -45,6 +45,9 @@
 #include "sprnodalrecoverymodel.h"
 #include "spatiallocalizer.h"
 #include "mmashapefunctprojection.h"
+#include "floatmatrixf.h"
+
+#include <utility>
 
 
 #define _IFT_TrPlaneStress2d_Name "trplanestress2d"
@@ -113,6 +116,14 @@ protected:
 
     virtual double giveArea();
     int giveNumberOfIPForMassMtrxIntegration() override { return 4; }
+    bool computeFixedSizeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep) override;
+    bool computeFixedSizeInternalForcesVector(FloatArray &answer, TimeStep *tStep) override;
+
+public:
+    /// Checks whether the fixed size kernels apply; derived elements modify the approximation and use the general implementation.
+    bool hasFixedSizeKernel();
+    /// Returns the Jacobian determinant and the fixed size geometric matrix at given integration point.
+    std :: pair< double, FloatMatrixF< 3, 6 > >computeFixedSizeBmatrixAt(GaussPoint *gp);
 };
 } // end namespace oofem
 #endif // trplanstrss_h
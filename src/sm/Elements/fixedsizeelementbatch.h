@@ -0,0 +1,297 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef fixedsizeelementbatch_h
+#define fixedsizeelementbatch_h
+
+#include "sm/Elements/fixedsizekernels.h"
+#include "sm/Elements/nlstructuralelement.h"
+#include "sm/Materials/structuralmaterial.h"
+#include "unknownnumberingscheme.h"
+#include "intarray.h"
+#include "interface.h"
+#include "interfacetype.h"
+#include "timestep.h"
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+namespace oofem {
+class Domain;
+
+/**
+ * Batch of elements whose internal forces are evaluated together, bypassing the generic element evaluation and assembly.
+ * Used by explicit solvers, which evaluate internal forces of the same elements many times.
+ */
+class ElementBatch
+{
+public:
+    virtual ~ElementBatch() { }
+
+    /// Returns the number of elements in batch.
+    virtual int giveNumberOfElements() const = 0;
+    /**
+     * Evaluates the internal forces of all elements in batch and adds them into global vector.
+     * @param answer Global internal force vector.
+     * @param u Global vector of total displacements, in the same equation numbering as used for building the batch.
+     * @param up Global vector of prescribed displacements, in the same prescribed equation numbering as used for building the batch.
+     * @param tStep Time step.
+     * @param concurrent Determines whether the elements may be evaluated by several threads.
+     */
+    virtual void computeInternalForces(FloatArray &answer, const FloatArray &u, const FloatArray &up, TimeStep *tStep, bool concurrent) = 0;
+};
+
+
+/**
+ * Batch of small strain elements of one type with fixed size kernels (see FixedSizeKernel).
+ * The location arrays, geometric matrices and integration weights of all elements are computed once and stored
+ * contiguously. The elements are ordered by colors, elements of one color share no equation, so that
+ * their contributions can be added into global vector by several threads without locking.
+ * Only elements without slave or rotated dofs, without activity time function and with local materials are accepted.
+ * @tparam ELEM Element class, providing hasFixedSizeKernel and computeFixedSizeBmatrixAt services.
+ * @tparam MODE Material mode of the element.
+ * @tparam NDOF Number of element unknowns.
+ */
+template< class ELEM, MaterialMode MODE, std :: size_t NDOF >
+class FixedSizeElementBatch : public ElementBatch
+{
+protected:
+    typedef FixedSizeKernelMode< MODE >Mode;
+
+    /// Elements, ordered by colors.
+    std :: vector< ELEM * >elements;
+    /// Equation numbers of element unknowns, NDOF entries per element; prescribed unknowns have negative prescribed equation numbers.
+    std :: vector< int >loc;
+    /// Index of first integration point of each element (and total number of integration points at the end).
+    std :: vector< int >gpStart;
+    /// Integration points.
+    std :: vector< GaussPoint * >gps;
+    /// Geometric matrices at integration points.
+    std :: vector< FloatMatrixF< Mode :: nstrains, NDOF > >b;
+    /// Integration volumes of integration points.
+    std :: vector< double >dV;
+    /// Index of first element of each color (and total number of elements at the end).
+    std :: vector< int >colorStart;
+
+public:
+    FixedSizeElementBatch() : gpStart(1, 0) { }
+
+    int giveNumberOfElements() const override { return ( int ) elements.size(); }
+
+    /**
+     * Adds the element to batch, if it can be evaluated by the batch.
+     * @param elem Element to add.
+     * @param s Equation numbering.
+     * @param ps Prescribed equation numbering.
+     * @return True if element was added.
+     */
+    bool addElement(ELEM *elem, const UnknownNumberingScheme &s, const UnknownNumberingScheme &ps)
+    {
+        FloatMatrix R;
+        IntArray eloc, ploc;
+        if ( !elem->hasFixedSizeKernel() || elem->giveGeometryMode() != 0 || elem->giveNumberOfIntegrationRules() != 1 ||
+             elem->giveParallelMode() != Element_local || elem->getActivityTimeFunctionNumber() || elem->giveRotationMatrix(R) ) {
+            return false;
+        }
+
+        elem->giveLocationArray(eloc, s);
+        elem->giveLocationArray(ploc, ps);
+        if ( eloc.giveSize() != ( int ) NDOF || ploc.giveSize() != ( int ) NDOF ) {
+            return false;
+        }
+
+        for ( int i = 1; i <= ( int ) NDOF; ++i ) {
+            if ( eloc.at(i) == 0 ) {
+                if ( ploc.at(i) == 0 ) {
+                    return false;
+                }
+                eloc.at(i) = -ploc.at(i);
+            }
+        }
+
+        StructuralCrossSection *cs = elem->giveStructuralCrossSection();
+        for ( GaussPoint *gp : * elem->giveDefaultIntegrationRulePtr() ) {
+            if ( cs->giveMaterial(gp)->giveInterface(NonlocalMaterialExtensionInterfaceType) ) {
+                return false;
+            }
+        }
+
+        for ( GaussPoint *gp : * elem->giveDefaultIntegrationRulePtr() ) {
+            auto jb = elem->computeFixedSizeBmatrixAt(gp);
+            gps.push_back(gp);
+            b.push_back(jb.second);
+            dV.push_back( std :: fabs(jb.first) * gp->giveWeight() * Mode :: giveThickness(cs, gp) );
+        }
+        gpStart.push_back( ( int ) gps.size() );
+        loc.insert( loc.end(), eloc.begin(), eloc.end() );
+        elements.push_back(elem);
+        return true;
+    }
+
+    /**
+     * Colors the elements, must be called after all elements are added.
+     * Colors are handed out in rounds of 64 using a bit mask per equation.
+     * @param neq Number of equations.
+     */
+    void finalize(int neq)
+    {
+        int nelem = this->giveNumberOfElements();
+        std :: vector< int >color(nelem), pending(nelem), deferred;
+        for ( int i = 0; i < nelem; ++i ) {
+            pending [ i ] = i;
+        }
+
+        std :: vector< uint64_t >mask;
+        int ncolors = 0;
+        for ( int round = 0; !pending.empty(); round += 64 ) {
+            mask.assign(neq + 1, 0);
+            deferred.clear();
+            for ( int e : pending ) {
+                const int *eloc = & loc [ e * NDOF ];
+                uint64_t used = 0;
+                for ( std :: size_t i = 0; i < NDOF; ++i ) {
+                    used |= mask [ std :: max(eloc [ i ], 0) ];
+                }
+
+                if ( ~used == 0 ) {
+                    deferred.push_back(e);
+                    continue;
+                }
+
+                int c = 0;
+                while ( used & ( uint64_t(1) << c ) ) {
+                    c++;
+                }
+
+                for ( std :: size_t i = 0; i < NDOF; ++i ) {
+                    if ( eloc [ i ] > 0 ) {
+                        mask [ eloc [ i ] ] |= uint64_t(1) << c;
+                    }
+                }
+                color [ e ] = round + c;
+                ncolors = std :: max(ncolors, round + c + 1);
+            }
+            pending.swap(deferred);
+        }
+
+        // reorder all element data by colors
+        colorStart.assign(ncolors + 1, 0);
+        for ( int e = 0; e < nelem; ++e ) {
+            colorStart [ color [ e ] + 1 ]++;
+        }
+        for ( int c = 0; c < ncolors; ++c ) {
+            colorStart [ c + 1 ] += colorStart [ c ];
+        }
+
+        std :: vector< int >next(colorStart.begin(), colorStart.end() - 1), order(nelem);
+        for ( int e = 0; e < nelem; ++e ) {
+            order [ next [ color [ e ] ]++ ] = e;
+        }
+
+        std :: vector< ELEM * >oElements;
+        std :: vector< int >oLoc, oGpStart(1, 0);
+        std :: vector< GaussPoint * >oGps;
+        std :: vector< FloatMatrixF< Mode :: nstrains, NDOF > >oB;
+        std :: vector< double >oDV;
+        oElements.reserve(nelem);
+        oLoc.reserve( loc.size() );
+        oGps.reserve( gps.size() );
+        oB.reserve( b.size() );
+        oDV.reserve( dV.size() );
+        for ( int e : order ) {
+            oElements.push_back(elements [ e ]);
+            oLoc.insert(oLoc.end(), loc.begin() + e * NDOF, loc.begin() + ( e + 1 ) * NDOF);
+            for ( int g = gpStart [ e ]; g < gpStart [ e + 1 ]; ++g ) {
+                oGps.push_back(gps [ g ]);
+                oB.push_back(b [ g ]);
+                oDV.push_back(dV [ g ]);
+            }
+            oGpStart.push_back( ( int ) oGps.size() );
+        }
+
+        elements.swap(oElements);
+        loc.swap(oLoc);
+        gpStart.swap(oGpStart);
+        gps.swap(oGps);
+        b.swap(oB);
+        dV.swap(oDV);
+    }
+
+    void computeInternalForces(FloatArray &answer, const FloatArray &u, const FloatArray &up, TimeStep *tStep, bool concurrent) override
+    {
+        for ( std :: size_t c = 0; c + 1 < colorStart.size(); ++c ) {
+            int start = colorStart [ c ], end = colorStart [ c + 1 ];
+#ifdef _OPENMP
+ #pragma omp parallel for if(concurrent) schedule(static)
+#endif
+            for ( int e = start; e < end; ++e ) {
+                const int *eloc = & loc [ e * NDOF ];
+                StructuralCrossSection *cs = elements [ e ]->giveStructuralCrossSection();
+
+                FloatArrayF< NDOF >ue, fe;
+                for ( std :: size_t i = 0; i < NDOF; ++i ) {
+                    ue [ i ] = eloc [ i ] > 0 ? u [ eloc [ i ] - 1 ] : up [ -eloc [ i ] - 1 ];
+                }
+
+                for ( int g = gpStart [ e ]; g < gpStart [ e + 1 ]; ++g ) {
+                    auto stress = Mode :: giveRealStress(cs, dot(b [ g ], ue), gps [ g ], tStep);
+                    fe += Tdot(b [ g ], stress) * dV [ g ];
+                }
+
+                for ( std :: size_t i = 0; i < NDOF; ++i ) {
+                    if ( eloc [ i ] > 0 ) {
+                        answer [ eloc [ i ] - 1 ] += fe [ i ];
+                    }
+                }
+            }
+        }
+    }
+};
+
+
+/**
+ * Creates the batches of all elements of domain, which can be evaluated by FixedSizeElementBatch.
+ * @param batches Created batches, one for each element type.
+ * @param batched Flags of elements included in batches, indexed by element number - 1.
+ * @param d Domain.
+ * @param s Equation numbering.
+ * @param ps Prescribed equation numbering.
+ * @param neq Number of equations.
+ */
+void createFixedSizeElementBatches(std :: vector< std :: unique_ptr< ElementBatch > > &batches, std :: vector< bool > &batched,
+                                   Domain *d, const UnknownNumberingScheme &s, const UnknownNumberingScheme &ps, int neq);
+} // end namespace oofem
+#endif // fixedsizeelementbatch_h
@@ -0,0 +1,162 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef fixedsizekernels_h
+#define fixedsizekernels_h
+
+#include "sm/Elements/structuralelement.h"
+#include "sm/CrossSections/structuralcrosssection.h"
+#include "floatarrayf.h"
+#include "floatmatrixf.h"
+#include "gausspoint.h"
+#include "integrationrule.h"
+#include "materialmode.h"
+
+#include <cmath>
+#include <utility>
+
+namespace oofem {
+/**
+ * Constitutive part of the fixed size element kernels, specialized for supported material modes.
+ */
+template< MaterialMode MODE >
+struct FixedSizeKernelMode;
+
+template< >
+struct FixedSizeKernelMode< _3dMat >
+{
+    static constexpr std :: size_t nstrains = 6;
+
+    static FloatMatrixF< 6, 6 >giveStiffnessMatrix(StructuralCrossSection *cs, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep)
+    { return cs->giveStiffnessMatrix_3d(mode, gp, tStep); }
+    static FloatArrayF< 6 >giveRealStress(StructuralCrossSection *cs, const FloatArrayF< 6 > &strain, GaussPoint *gp, TimeStep *tStep)
+    { return cs->giveRealStress_3d(strain, gp, tStep); }
+    static double giveThickness(StructuralCrossSection *cs, GaussPoint *gp) { return 1.; }
+};
+
+template< >
+struct FixedSizeKernelMode< _PlaneStress >
+{
+    static constexpr std :: size_t nstrains = 3;
+
+    static FloatMatrixF< 3, 3 >giveStiffnessMatrix(StructuralCrossSection *cs, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep)
+    { return cs->giveStiffnessMatrix_PlaneStress(mode, gp, tStep); }
+    static FloatArrayF< 3 >giveRealStress(StructuralCrossSection *cs, const FloatArrayF< 3 > &strain, GaussPoint *gp, TimeStep *tStep)
+    { return cs->giveRealStress_PlaneStress(strain, gp, tStep); }
+    static double giveThickness(StructuralCrossSection *cs, GaussPoint *gp) { return cs->give(CS_Thickness, gp); }
+};
+
+
+/**
+ * Stiffness matrix and internal force kernels of solid and plane elements working entirely with fixed size
+ * matrices, so that all products are sized at compile time.
+ * The element supplies the geometric matrix of its integration points by an evaluator, callable as
+ * evaluator(gp) and returning the pair of Jacobian determinant and geometric matrix
+ * (FloatMatrixF< nstrains, NDOF >). The kernels integrate over the default integration rule and assume
+ * small strains and material axes aligned with global ones; elements call them only in such configurations
+ * (see NLStructuralElement::computeFixedSizeStiffnessMatrix).
+ * @tparam MODE Material mode of the element.
+ * @tparam NDOF Number of element unknowns.
+ */
+template< MaterialMode MODE, std :: size_t NDOF >
+class FixedSizeKernel
+{
+public:
+    typedef FixedSizeKernelMode< MODE >Mode;
+
+    /// Computes the stiffness matrix @f$ K = \int_V B^{\mathrm{T}} D B dV @f$.
+    template< class Evaluator >
+    static FloatMatrixF< NDOF, NDOF >computeStiffnessMatrix(StructuralElement &elem, MatResponseMode rMode, TimeStep *tStep, Evaluator &&evaluator)
+    {
+        StructuralCrossSection *cs = elem.giveStructuralCrossSection();
+        FloatMatrixF< NDOF, NDOF >answer;
+        for ( GaussPoint *gp : * elem.giveDefaultIntegrationRulePtr() ) {
+            auto jb = evaluator(gp);
+            double dV = std :: fabs(jb.first) * gp->giveWeight() * Mode :: giveThickness(cs, gp);
+            auto db = dot(Mode :: giveStiffnessMatrix(cs, rMode, gp, tStep), jb.second);
+            answer += Tdot(jb.second, db * dV);
+        }
+        return answer;
+    }
+
+    /// Computes the internal forces @f$ f = \int_V B^{\mathrm{T}} \sigma(B u) dV @f$, updating the material statuses.
+    template< class Evaluator >
+    static FloatArrayF< NDOF >computeInternalForces(StructuralElement &elem, const FloatArrayF< NDOF > &u, TimeStep *tStep, Evaluator &&evaluator)
+    {
+        StructuralCrossSection *cs = elem.giveStructuralCrossSection();
+        FloatArrayF< NDOF >answer;
+        for ( GaussPoint *gp : * elem.giveDefaultIntegrationRulePtr() ) {
+            auto jb = evaluator(gp);
+            double dV = std :: fabs(jb.first) * gp->giveWeight() * Mode :: giveThickness(cs, gp);
+            auto stress = Mode :: giveRealStress(cs, dot(jb.second, u), gp, tStep);
+            answer += Tdot(jb.second, stress) * dV;
+        }
+        return answer;
+    }
+};
+
+
+/// Geometric matrix of 3d solids, with engineering shear strains ordered as yz, xz, xy.
+template< std :: size_t N >
+FloatMatrixF< 6, N * 3 >solidBmatrix(const FloatMatrixF< 3, N > &dNdx, const FloatMatrixF< 3, N > &dNdxShear)
+{
+    FloatMatrixF< 6, N * 3 >b;
+    for ( std :: size_t i = 0; i < N; ++i ) {
+        b(0, 3 * i + 0) = dNdx(0, i);
+        b(1, 3 * i + 1) = dNdx(1, i);
+        b(2, 3 * i + 2) = dNdx(2, i);
+
+        b(4, 3 * i + 0) = b(3, 3 * i + 1) = dNdxShear(2, i);
+        b(5, 3 * i + 0) = b(3, 3 * i + 2) = dNdxShear(1, i);
+        b(5, 3 * i + 1) = b(4, 3 * i + 2) = dNdxShear(0, i);
+    }
+    return b;
+}
+
+/// Geometric matrix of plane stress elements.
+template< std :: size_t N >
+FloatMatrixF< 3, N * 2 >planeStressBmatrix(const FloatMatrixF< 2, N > &dNdx, const FloatMatrixF< 2, N > &dNdxShear)
+{
+    FloatMatrixF< 3, N * 2 >b;
+    for ( std :: size_t i = 0; i < N; ++i ) {
+        b(0, 2 * i + 0) = dNdx(0, i);
+        b(1, 2 * i + 1) = dNdx(1, i);
+
+        b(2, 2 * i + 0) = dNdxShear(1, i);
+        b(2, 2 * i + 1) = dNdxShear(0, i);
+    }
+    return b;
+}
+} // end namespace oofem
+#endif // fixedsizekernels_h
@@ -88,6 +88,11 @@ class NLStructuralElement : public StructuralElement
 protected:
     /// Flag indicating if geometrical nonlinearities apply.
     int nlGeometry;
+    /**
+     * Displacements of receiver (D_u, D_v, D_w unknowns) gathered once for an evaluation over all integration
+     * points, used by computeDeformationGradientVector; nullptr outside of such evaluation.
+     */
+    const FloatArray *gatheredDeformationDisplacements;
 
 public:
     /**
@@ -232,6 +237,23 @@ protected:
         OOFEM_ERROR("method not implemented for this element");
         return;
     }
+    /**
+     * Computes the stiffness matrix by a fixed size element kernel (see FixedSizeKernel), if receiver provides one.
+     * Called only for small strains, a single integration rule and an active element.
+     * @param answer Stiffness matrix.
+     * @param rMode Response mode.
+     * @param tStep Time step.
+     * @return False if receiver has no kernel for its current configuration, the general implementation is used then.
+     */
+    virtual bool computeFixedSizeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep) { return false; }
+    /**
+     * Computes the internal forces by a fixed size element kernel, if receiver provides one.
+     * Called under the same conditions as computeFixedSizeStiffnessMatrix, with stresses evaluated from current strains.
+     * @param answer Internal force vector.
+     * @param tStep Time step.
+     * @return False if receiver has no kernel for its current configuration.
+     */
+    virtual bool computeFixedSizeInternalForcesVector(FloatArray &answer, TimeStep *tStep) { return false; }
     friend class GradientDamageElement;
     friend class PhaseFieldElement;
     friend class XfemStructuralElementInterface;
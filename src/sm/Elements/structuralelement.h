@@ -41,8 +41,10 @@
 #include "integrationdomain.h"
 #include "dofmantransftype.h"
 #include "floatarray.h"
+#include "floatmatrix.h"
 
 #include <memory>
+#include <vector>
 
 namespace oofem {
 #define ALL_STRAINS -1
@@ -98,6 +100,21 @@ protected:
     /// Initial displacement vector, describes the initial nodal displacements when element has been casted.
     std :: unique_ptr< FloatArray >initialDisplacements;
 
+    /**
+     * Geometry cache of the default integration rule, used only if enabled by the engineering model
+     * (see EngngModel::giveGeometryCacheFlag). Keeps the geometric matrices and integration volumes
+     * of integration points together with the nodal coordinates they were computed for.
+     */
+    std :: vector< FloatMatrix >bMatrixCache;
+    std :: vector< double >dVCache;
+    FloatArray geometryCacheCoords;
+
+    /**
+     * Element displacement vector gathered once for an evaluation over all integration points of receiver
+     * (see giveDisplacementVector), nullptr outside of such evaluation.
+     */
+    const FloatArray *gatheredDisplacements;
+
 public:
     /**
      * Constructor. Creates structural element with given number, belonging to given domain.
@@ -298,6 +315,11 @@ public:
     int checkConsistency() override;
     void initializeFrom(InputRecord &ir) override;
     void giveInputRecord(DynamicInputRecord &input) override;
+
+    /// Discards the cached geometric data of receiver, forcing their recomputation.
+    void invalidateGeometryCache();
+    /// Returns the memory (in bytes) occupied by the geometry cache of receiver.
+    std :: size_t giveGeometryCacheSize() const;
     const char *giveClassName() const override { return "StructuralElement"; }
 
 #ifdef __OOFEG
@@ -495,6 +517,41 @@ public:
     virtual void computeNmatrixAt(const FloatArray &iLocCoord, FloatMatrix &answer);
 
 protected:
+    /**
+     * Returns the geometric matrix of receiver at given integration point for all strains.
+     * If the geometry cache is enabled and gp belongs to the default integration rule,
+     * the matrix is computed only once and then taken from the cache; otherwise
+     * computeBmatrixAt is called.
+     * @param gp Integration point.
+     * @param work Storage for the matrix when it is not cached.
+     * @return Reference to cached matrix or to work.
+     */
+    const FloatMatrix &giveBmatrixAt(GaussPoint *gp, FloatMatrix &work);
+    /**
+     * Returns the integration volume of given integration point, taken from the geometry cache
+     * if possible (see giveBmatrixAt).
+     * @param gp Integration point.
+     * @return Result of computeVolumeAround.
+     */
+    double giveVolumeAround(GaussPoint *gp);
+    /**
+     * Checks whether the geometry cache can be used for given integration point.
+     * The cache is cleared when the nodal coordinates differ from those it was computed for
+     * (remeshing, updated Lagrangian formulations, adaptive updates). Elements with XFEM enrichment are never cached.
+     * @param gp Integration point.
+     * @return True if cache is enabled and gp belongs to the default integration rule.
+     */
+    bool checkGeometryCache(GaussPoint *gp);
+    /**
+     * Returns the element displacement vector used for evaluation of strains, i.e., the total displacements
+     * of element unknowns reduced by initial displacements (if defined). Within an evaluation over all integration
+     * points, the vector gathered once at its beginning is returned instead of collecting the unknowns again.
+     * @param tStep Time step.
+     * @param work Storage used when no gathered vector is available.
+     * @return Reference to gathered vector or to work.
+     */
+    const FloatArray &giveDisplacementVector(TimeStep *tStep, FloatArray &work);
+
     /**
      * Return desired number of integration points for consistent mass matrix
      * computation, if required.
@@ -42,6 +42,7 @@
 #include "sparsemtrxtype.h"
 
 #include <memory>
+#include <vector>
 
 #define LOCAL_ZERO_MASS_REPLACEMENT 1
 
@@ -55,9 +56,12 @@
 #define _IFT_NlDEIDynamic_py "py"
 #define _IFT_NlDEIDynamic_nonlocalext "nonlocalext"
 #define _IFT_NlDEIDynamic_reduct "reduct"
+#define _IFT_NlDEIDynamic_elementbatches "elementbatches"
 //@}
 
 namespace oofem {
+class ElementBatch;
+
 /**
  * This class implements NonLinear (- may be changed) solution of dynamic
  * problems using Direct Explicit Integration scheme - Central Difference
@@ -87,6 +91,10 @@ namespace oofem {
  * - Additional mode has been introduced remote element mode. It introduces the "remote" elements, the
  *   exact local mirrors of remote counterparts. Introduced to support general nonlocal constitutive models,
  *   in order to provide efficient way, how to average local data without need of fine grain communication.
+ *
+ * Optionally (elementbatches keyword), the small strain elements with fixed size kernels are grouped into batches
+ * of the same element type, with location arrays and geometric matrices computed once (see FixedSizeElementBatch).
+ * The internal forces of the batches are then evaluated without the generic element evaluation and assembly.
  */
 class NlDEIDynamic : public StructuralEngngModel
 {
@@ -125,6 +133,13 @@ protected:
     /// Product of p^tM^(-1)p; where p is reference load vector.
     double pMp;
 
+    /// Flag indicating whether the internal forces of supported elements are evaluated in batches.
+    bool elementBatches;
+    /// Element batches, created at first evaluation of internal forces.
+    std :: vector< std :: unique_ptr< ElementBatch > >batches;
+    /// Flags of elements evaluated in batches.
+    std :: vector< bool >batchedElements;
+
     LinSystSolverType solverType;
     SparseMtrxType sparseMtrxType;
     std::unique_ptr<SparseLinearSystemNM> nMethod;
@@ -138,6 +153,7 @@ public:
     void solveYourselfAt(TimeStep *tStep) override;
 
     void updateYourself(TimeStep *tStep) override;
+    void updateInternalRHS(FloatArray &answer, TimeStep *tStep, Domain *d, FloatArray *eNorm) override;
     double giveUnknownComponent(ValueModeType type, TimeStep *tStep, Domain *d, Dof *dof) override;
     void initializeFrom(InputRecord &ir) override;
 
@@ -146,6 +146,10 @@ public:
     { return IsotropicDamageMaterial1 :: computeEquivalentStrain(strain, gp, tStep); }
 
     void updateBeforeNonlocAverage(const FloatArray &strainVector, GaussPoint *gp, TimeStep *tStep) const override;
+    /// Stress-based averaging modifies the weights for each receiver, thus it can not be evaluated by averaging sweep.
+    bool supportsAveragingSweep() const override { return this->nlvar != NLVT_StressBased; }
+    double giveLocalVariableForAverage(GaussPoint *gp) const override
+    { return static_cast< IDNLMaterialStatus * >( this->giveStatus(gp) )->giveLocalEquivalentStrainForAverage(); }
 
     /// Compute the factor that specifies how the interaction length should be modified (by eikonal nonlocal damage models)
     double giveNonlocalMetricModifierAt(GaussPoint *gp) const override;
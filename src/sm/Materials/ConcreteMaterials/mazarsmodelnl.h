@@ -121,6 +121,9 @@ public:
     { return MazarsMaterial :: computeEquivalentStrain(strain, gp, tStep); }
 
     void updateBeforeNonlocAverage(const FloatArray &strainVector, GaussPoint *gp, TimeStep *tStep) const override;
+    bool supportsAveragingSweep() const override { return true; }
+    double giveLocalVariableForAverage(GaussPoint *gp) const override
+    { return static_cast< MazarsNLMaterialStatus * >( this->giveStatus(gp) )->giveLocalEquivalentStrainForAverage(); }
   double computeWeightFunction(const double cl, const FloatArray &src, const FloatArray &coord) const override;
     int hasBoundedSupport() const override { return 1; }
     /**
@@ -192,6 +192,8 @@ public:
     virtual ~MPlasticMaterial2();
 
     bool hasMaterialModeCapability(MaterialMode mode) const override;
+    // populationSet is modified during return mapping
+    bool supportsConcurrentEvaluation() const override { return false; }
     const char *giveClassName() const override { return "MPlasticMaterial2"; }
 
     /// Returns reference to undamaged (bulk) material
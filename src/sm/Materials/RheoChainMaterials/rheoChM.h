@@ -244,6 +244,8 @@ public:
     bool hasMaterialModeCapability(MaterialMode mode) const override;
 
     bool hasCastingTimeSupport() const override { return true; }
+    // moduli of the units and the spring are cached in the receiver
+    bool supportsConcurrentEvaluation() const override { return false; }
 
     const char *giveClassName() const override { return "RheoChainMaterial"; }
     void initializeFrom(InputRecord &ir) override;
@@ -140,6 +140,8 @@ public:
     void giveInputRecord(DynamicInputRecord &input) override;
 
     MaterialStatus *CreateStatus(GaussPoint *gp) const override;
+    // the user subroutine may keep its own (static) state
+    bool supportsConcurrentEvaluation() const override { return false; }
 
     FloatMatrixF<6,6> give3dMaterialStiffnessMatrix(MatResponseMode mode, GaussPoint *gp, TimeStep *tStep) const override;
 
@@ -235,6 +235,8 @@ public:
     }
 
     bool hasMaterialModeCapability(MaterialMode mode) const override;
+    // mdm_Ep and mdm_Efp are modified during evaluation
+    bool supportsConcurrentEvaluation() const override { return false; }
 
     void giveRealStressVector(FloatArray &answer, GaussPoint *gp,
                               const FloatArray &reducedStrain, TimeStep *tStep) override;
@@ -114,6 +114,9 @@ public:
     {
         return RankineMat :: computeCumPlastStrain(gp, tStep);
     }
+    bool supportsAveragingSweep() const override { return true; }
+    double giveLocalVariableForAverage(GaussPoint *gp) const override
+    { return static_cast< RankineMatNlStatus * >( this->giveStatus(gp) )->giveLocalCumPlasticStrainForAverage(); }
 
 
     FloatMatrixF<3,3> givePlaneStressStiffMtrx(MatResponseMode mmode, GaussPoint *gp, TimeStep *tStep) const override;
@@ -39,12 +39,15 @@
 #include "sm/Materials/structuralms.h"
 
 #include <memory>
+#include <map>
 
 ///@name Input fields for StructuralFE2Material
 //@{
 #define _IFT_StructuralFE2Material_Name "structfe2material"
 #define _IFT_StructuralFE2Material_fileName "filename"
 #define _IFT_StructuralFE2Material_useNumericalTangent "use_num_tangent"
+#define _IFT_StructuralFE2Material_cacheTolerance "rvecachetol"
+#define _IFT_StructuralFE2Material_linearRVE "rvelinear"
 //@}
 
 namespace oofem {
@@ -65,6 +68,23 @@ protected:
     /// Interface normal direction
     FloatArray mNormalDir;
 
+    /// Macro strain for which the RVE was solved last, and the resulting stress.
+    FloatArray solvedStrain, solvedStress;
+    /// Time step number and solution state counter of the last RVE solution.
+    int solvedStep = -1, solvedState = -1;
+    /// Numerical tangent and the time step number and solution state counter in which it was computed.
+    FloatMatrix numTangent;
+    int numTangentStep = -1, numTangentState = -1;
+
+    /// Macro strain and stress of the last solution of the RVE, the base point of predictions.
+    FloatArray rveStrain, rveStress;
+    /// Tangent at the last solution of the RVE, in the form of rveStrain (empty if not available).
+    FloatMatrix predictorTangent;
+    /// Macro strain of the temporary state, if the state was predicted without solving the RVE.
+    FloatArray predictedStrain;
+    /// Set while the numerical tangent is evaluated, the RVE is then always solved.
+    bool perturbing = false;
+
     std :: string mInputFile;
 
 public:
@@ -79,11 +99,51 @@ public:
     /// Creates/Initiates the RVE problem.
     bool createRVE(int n, const std :: string &inputfile, int rank);
 
-    /// Copies time step data to RVE.
-    void setTimeStep(TimeStep *tStep);
+    /**
+     * Copies time step data to RVE.
+     * The RVE is solved in its own time step, so that the concurrently solved RVEs do not modify the macro time step.
+     * @return Time step of the RVE.
+     */
+    TimeStep *setTimeStep(TimeStep *tStep);
 
     FloatMatrix &giveTangent() { return tangent; }
 
+    /**
+     * Checks if the RVE has been already solved for given macro strain in current solution state
+     * (typically by concurrent evaluation ahead of the element loop).
+     * @param answer Stress computed for the strain.
+     * @param strain Macro strain.
+     * @param tStep Solution step.
+     * @return True if solved, false otherwise.
+     */
+    bool giveSolvedStress(FloatArray &answer, const FloatArray &strain, TimeStep *tStep) const;
+    /// Records the stress obtained by solution of the RVE for given strain.
+    void letSolvedStressBe(const FloatArray &strain, const FloatArray &stress, TimeStep *tStep);
+    /// Returns true if the numerical tangent of given size has been already computed in current solution state.
+    bool giveNumericalTangent(FloatMatrix &answer, int size, TimeStep *tStep) const;
+    /// Records the numerical tangent computed in current solution state.
+    void letNumericalTangentBe(const FloatMatrix &answer, TimeStep *tStep);
+    /// Invalidates the recorded RVE solution and numerical tangent.
+    void clearSolvedState() { solvedState = numTangentState = -1; }
+
+    /**
+     * Solves the RVE for given macro strain and records the solution as the base point of predictions.
+     * @param strain Macro strain, either the full 3d form or the plane stress form.
+     * @return Homogenized stress in the form of the strain.
+     */
+    FloatArray solveRVE(const FloatArray &strain, TimeStep *tStep);
+    /// Forgets the base point of predictions, the RVE no longer corresponds to it.
+    void clearPrediction() { rveStrain.clear(); predictedStrain.clear(); }
+    const FloatArray &giveRVEStrain() const { return rveStrain; }
+    const FloatArray &giveRVEStress() const { return rveStress; }
+    const FloatMatrix &givePredictorTangent() const { return predictorTangent; }
+    void letPredictorTangentBe(const FloatMatrix &t) { predictorTangent = t; }
+    /// Marks the temporary state as predicted for given strain, the RVE is solved for it when the state is accepted.
+    void letPredictedStrainBe(const FloatArray &strain) { predictedStrain = strain; }
+    bool isPredicted() const { return predictedStrain.isNotEmpty(); }
+    bool isPerturbing() const { return perturbing; }
+    void setPerturbing(bool val) { perturbing = val; }
+
     const char *giveClassName() const override { return "StructuralFE2MaterialStatus"; }
 
     void initTempStatus() override;
@@ -123,6 +183,12 @@ protected:
     std :: string inputfile;
     static int n;
     bool useNumTangent = false;
+    /// Relative change of macro strain within which the response is predicted from the last RVE solution and its tangent (zero disables the prediction).
+    double cacheTolerance = 0.;
+    /// Linear elastic RVE; the condensed tangent is computed once and used in all points instead of solving the RVEs.
+    bool linearRVE = false;
+    /// Condensed tangents of the linear RVE for each material mode.
+    mutable std :: map< MaterialMode, FloatMatrix >linearTangents;
 
 public:
     StructuralFE2Material(int n, Domain * d);
@@ -132,13 +198,30 @@ public:
     const char *giveInputRecordName() const override { return _IFT_StructuralFE2Material_Name; }
     const char *giveClassName() const override { return "StructuralFE2Material"; }
     bool isCharacteristicMtrxSymmetric(MatResponseMode rMode) const override { return true; }
+    // the RVE problems are solved using the shared solver and output infrastructure
+    bool supportsConcurrentEvaluation() const override { return false; }
+    /// Solves the RVEs of all integration points concurrently (each point owns its RVE problem with its own solver).
+    void updateDomainResponse(Domain *d, TimeStep *tStep, bool tangent) override;
 
     MaterialStatus *CreateStatus(GaussPoint *gp) const override;
     FloatArrayF<6> giveRealStressVector_3d(const FloatArrayF<6> &strain, GaussPoint *gp, TimeStep *tStep) const override;
+    FloatArrayF<4> giveRealStressVector_PlaneStrain(const FloatArrayF< 4 > &strain, GaussPoint *gp, TimeStep *tStep) const override;
     FloatArrayF<3> giveRealStressVector_PlaneStress(const FloatArrayF< 3 > &strain, GaussPoint *gp, TimeStep *tStep) const override;
     FloatMatrixF<6,6> give3dMaterialStiffnessMatrix(MatResponseMode mode, GaussPoint *gp, TimeStep *tStep) const override;
     FloatMatrixF<4,4> givePlaneStrainStiffMtrx(MatResponseMode mode, GaussPoint *gp, TimeStep *tStep) const override;
     FloatMatrixF<3,3> givePlaneStressStiffMtrx(MatResponseMode mmode, GaussPoint *gp, TimeStep *tStep) const override;
+
+protected:
+    /**
+     * Gives the condensed tangent of the linear RVE in given material mode. The tangent is computed once,
+     * by the RVE of the first point requesting it.
+     */
+    FloatMatrix giveLinearTangent(MaterialMode mode, GaussPoint *gp, TimeStep *tStep) const;
+    /**
+     * Predicts the stress from the last solution of the RVE and its tangent, if the strain is within the cache tolerance.
+     * @return True if predicted, false if the RVE has to be solved.
+     */
+    bool predictStress(FloatArray &answer, const FloatArray &strain, StructuralFE2MaterialStatus *status) const;
 };
 
 } // end namespace oofem
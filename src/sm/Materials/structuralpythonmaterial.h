@@ -111,6 +111,8 @@ public:
 
     const char *giveClassName() const override { return "StructuralPythonMaterial"; }
     const char *giveInputRecordName() const override { return _IFT_StructuralPythonMaterial_Name; }
+    // the python interpreter must not be entered concurrently
+    bool supportsConcurrentEvaluation() const override { return false; }
 };
 
 class StructuralPythonMaterialStatus : public StructuralMaterialStatus
@@ -192,6 +192,8 @@ public:
     void giveInputRecord(DynamicInputRecord &input) override;
     const char *giveInputRecordName() const override { return _IFT_StructuralSlipFE2Material_Name; }
     const char *giveClassName() const override { return "StructuralSlipFE2Material"; }
+    /// The RVEs are solved together with the slip fields from the element loop.
+    void updateDomainResponse(Domain *d, TimeStep *tStep, bool tangent) override { }
 
     FloatMatrixF<3,3> givePlaneStressStiffMtrx(MatResponseMode mmode, GaussPoint *gp, TimeStep *tStep) const override;
     FloatArrayF<3> giveRealStressVector_PlaneStress(const FloatArrayF< 3 > &strain, GaussPoint *gp, TimeStep *tStep) const override;
@@ -61,6 +61,7 @@ using namespace tinyxml2;
 #define _IFT_CemhydMat_capacitytype "capacitytype"
 #define _IFT_CemhydMat_densitytype "densitytype"
 #define _IFT_CemhydMat_eachgp "eachgp"
+#define _IFT_CemhydMat_parallel "parallel"
 #define _IFT_CemhydMat_nowarnings "nowarnings"
 #define _IFT_CemhydMat_scaling "scaling"
 #define _IFT_CemhydMat_reinforcementDegree "reinforcementdegree"
@@ -124,6 +125,8 @@ public:
     virtual void storeWeightTemperatureProductVolume(Element *element, TimeStep *tStep);
     /// Perform averaging on a master CemhydMatStatus.
     virtual void averageTemperature();
+    /// Evolves the microstructures of all integration points to the target time concurrently (eachGP with parallel flag only).
+    void updateDomainResponse(Domain *d, TimeStep *tStep, bool tangent) override;
 
     void initializeFrom(InputRecord &ir) override;
     /// Use different methods to evaluate material parameters
@@ -136,6 +139,8 @@ public:
     int reinforcementDegree;
     /// Assign a separate microstructure in each integration point.
     int eachGP;
+    /// Evolve the separate microstructures concurrently before the internal source is assembled.
+    bool parallel;
     /// XML input file name for CEMHYD3D.
     std :: string XMLfileName;
     MaterialStatus *CreateStatus(GaussPoint *gp) const override;
@@ -484,6 +489,9 @@ private:
     void connect(void);
     void outmic(void);
     int genpartnew(void);
+    /// Allocates a cubic grid as one packed block, addressed through row pointers as mic[x][y][z].
+    template< class T >void alloc_3D(T ***( &mic ), long SYSIZE);
+    template< class T >void dealloc_3D(T ***( &mic ), long SYSIZE);
     void alloc_char_3D(char ***( &mic ), long SYSIZE);
     void dealloc_char_3D(char ***( &mic ), long SYSIZE);
     void alloc_long_3D(long ***( &mic ), long SYSIZE);
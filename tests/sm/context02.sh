@@ -0,0 +1,14 @@
+#
+# this test check save/restore of compressed incremental context files
+#
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+echo "Command: $OOFEM -f context02.in.0 -c"
+# run target on input and store context file
+$OOFEM -f context02.in.0 -c
+echo "Command: $OOFEM -f context02.in.0 -r 2"
+# run target on the same file, but restarting from step 3
+$OOFEM -f context02.in.0 -r 2
+